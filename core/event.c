@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_event
+ * @{
+ *
+ * @file
+ * @brief       Event queue implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "event.h"
+#include "irq.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+void event_queue_init(event_queue_t *queue)
+{
+    assert(queue);
+    memset(queue, '\0', sizeof(*queue));
+    queue->waiter = (thread_t *)sched_active_thread;
+}
+
+void event_queue_claim(event_queue_t *queue)
+{
+    assert(queue);
+    unsigned state = irq_disable();
+    queue->waiter = (thread_t *)sched_active_thread;
+    irq_restore(state);
+}
+
+void event_post(event_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    if (!event->list_node.next) {
+        clist_rpush(&queue->event_list, &event->list_node);
+    }
+    thread_t *waiter = queue->waiter;
+    irq_restore(state);
+
+    /* a detached queue is checked when its thread claims it */
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+void event_cancel(event_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    clist_remove(&queue->event_list, &event->list_node);
+    event->list_node.next = NULL;
+    irq_restore(state);
+}
+
+event_t *event_get(event_queue_t *queue)
+{
+    unsigned state = irq_disable();
+    event_t *result = (event_t *)clist_lpop(&queue->event_list);
+    if (result) {
+        result->list_node.next = NULL;
+    }
+    irq_restore(state);
+
+    return result;
+}
+
+event_t *event_wait(event_queue_t *queue)
+{
+    event_t *result;
+
+    assert(queue->waiter == sched_active_thread);
+    /* the flag may be left over from events that were taken with
+     * event_get(), so the queue itself is checked first */
+    while ((result = event_get(queue)) == NULL) {
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+    DEBUG("event: handling %p\n", (void *)result);
+
+    return result;
+}
+
+void event_loop(event_queue_t *queue)
+{
+    while (1) {
+        event_t *event = event_wait(queue);
+        event->handler(event);
+    }
+}
+
+static void _event_callback_handler(event_t *event)
+{
+    event_callback_t *event_callback = (event_callback_t *)event;
+    event_callback->callback(event_callback->arg);
+}
+
+void event_callback_init(event_callback_t *event_callback,
+                         void (*callback)(void *), void *arg)
+{
+    memset(event_callback, '\0', sizeof(*event_callback));
+    event_callback->super.handler = _event_callback_handler;
+    event_callback->callback = callback;
+    event_callback->arg = arg;
+}
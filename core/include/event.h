@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    core_event Event queues
+ * @ingroup     core
+ * @brief       Queues of callbacks that are executed by a handler thread
+ *
+ * An event is an object that holds a handler function. Events can be posted
+ * to an event queue from threads and from interrupt context. The thread that
+ * owns the queue takes the events out of the queue in FIFO order and calls
+ * their handlers.
+ *
+ * Events are intrusive, they are linked into the queue directly and no memory
+ * is allocated. The same event can be posted multiple times, it is only
+ * queued once until it was handled. To pass data to a handler, embed the
+ * event into a larger structure and use `container_of()`, or use
+ * @ref event_callback_t.
+ *
+ * Unlike messages, posting an event cannot fail, and many modules can share
+ * one thread (and its stack) by posting their work to the same queue, see
+ * @ref sys_event_thread. Events can be posted with a delay using
+ * @ref sys_event_timeout.
+ *
+ * The handler thread waits for events using the thread flag
+ * @ref THREAD_FLAG_EVENT, so it can wait for other thread flags at the same
+ * time.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event queue API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef EVENT_H
+#define EVENT_H
+
+#include <stdint.h>
+
+#include "clist.h"
+#include "kernel_defines.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Thread flag used to signal new events to the queue's thread
+ */
+#ifndef THREAD_FLAG_EVENT
+#define THREAD_FLAG_EVENT   (0x1)
+#endif
+
+/**
+ * @brief   Static initializer for an event queue that has no thread yet
+ *
+ * The thread takes over such a queue with event_queue_claim().
+ */
+#define EVENT_QUEUE_INIT_DETACHED   { .waiter = NULL }
+
+/**
+ * @brief   event_t forward declaration
+ */
+typedef struct event event_t;
+
+/**
+ * @brief   Event handler type
+ */
+typedef void (*event_handler_t)(event_t *);
+
+/**
+ * @brief   Event structure
+ */
+struct event {
+    clist_node_t list_node;     /**< event queue list entry, NULL if the
+                                 *   event is not queued */
+    event_handler_t handler;    /**< called by the queue's thread */
+};
+
+/**
+ * @brief   Event queue structure
+ */
+typedef struct {
+    clist_node_t event_list;    /**< list of queued events */
+    thread_t *waiter;           /**< thread handling the events */
+} event_queue_t;
+
+/**
+ * @brief   Callback event structure
+ */
+typedef struct {
+    event_t super;              /**< event_t structure that gets extended */
+    void (*callback)(void*);    /**< callback function */
+    void *arg;                  /**< callback function argument */
+} event_callback_t;
+
+/**
+ * @brief   Initialize an event queue for the calling thread
+ *
+ * @param[out]  queue   event queue object to initialize
+ */
+void event_queue_init(event_queue_t *queue);
+
+/**
+ * @brief   Make the calling thread the handler of a detached event queue
+ *
+ * Events that were posted before are kept.
+ *
+ * @param[in,out]   queue   queue initialized with
+ *                          @ref EVENT_QUEUE_INIT_DETACHED
+ */
+void event_queue_claim(event_queue_t *queue);
+
+/**
+ * @brief   Queue an event
+ *
+ * Can be called from interrupt context. If @p event is already queued, this
+ * is a no-op.
+ *
+ * @param[in]   queue   event queue to queue event in
+ * @param[in]   event   event to queue in event queue
+ */
+void event_post(event_queue_t *queue, event_t *event);
+
+/**
+ * @brief   Dequeue an event
+ *
+ * Can be called from interrupt context. If @p event is not queued, this is a
+ * no-op.
+ *
+ * @param[in]   queue   event queue to remove event from
+ * @param[in]   event   event to remove from queue
+ */
+void event_cancel(event_queue_t *queue, event_t *event);
+
+/**
+ * @brief   Get next event from event queue, non-blocking
+ *
+ * @param[in]   queue   event queue to get event from
+ *
+ * @return  pointer to next event
+ * @return  NULL if no event available
+ */
+event_t *event_get(event_queue_t *queue);
+
+/**
+ * @brief   Get next event from event queue, blocking
+ *
+ * Must only be called by the queue's thread.
+ *
+ * @param[in]   queue   event queue to get event from
+ *
+ * @return  pointer to next event
+ */
+event_t *event_wait(event_queue_t *queue);
+
+/**
+ * @brief   Simple event loop
+ *
+ * Waits for events and calls their handlers, never returns. Must only be
+ * called by the queue's thread.
+ *
+ * @param[in]   queue   event queue to process
+ */
+NORETURN void event_loop(event_queue_t *queue);
+
+/**
+ * @brief   Initialize a callback event
+ *
+ * @param[out]  event_callback  object to initialize
+ * @param[in]   callback        callback to set up
+ * @param[in]   arg             callback argument to set up
+ */
+void event_callback_init(event_callback_t *event_callback,
+                         void (*callback)(void *), void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_H */
+/** @} */
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    core_mbox_payload Mailboxes with payload buffers
+ * @ingroup     core_mbox
+ * @brief       Zero-copy passing of data blocks between threads
+ *
+ * A payload pool holds a fixed number of equally sized buffers. A sender
+ * allocates a buffer from the pool, fills it and puts it into a mailbox.
+ * Only a reference to the buffer and its length are queued, the data is
+ * never copied. The receiver gets the buffer from the mailbox, uses it and
+ * returns it to the pool with mbox_payload_free().
+ *
+ * Ownership of a buffer is explicit: after mbox_payload_alloc() the caller
+ * owns it, mbox_payload_put() hands it over to whoever gets it from the
+ * mailbox, and mbox_payload_free() gives it back to the pool. A thread must
+ * not touch a buffer it does not own.
+ *
+ * The pool's free list is a mailbox itself, so allocating from an exhausted
+ * pool blocks until another thread frees a buffer, which throttles a
+ * producer that is faster than its consumer.
+ *
+ * A mailbox used with mbox_payload_put() should only carry payload
+ * messages, as the message type field holds the payload length.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Mailbox payload API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef MBOX_PAYLOAD_H
+#define MBOX_PAYLOAD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mbox.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Payload buffer pool
+ */
+typedef struct {
+    mbox_t free;            /**< mailbox holding the free buffers */
+    uint8_t *bufs;          /**< start of the buffer memory */
+    size_t buf_size;        /**< size of a single buffer */
+    unsigned numof;         /**< number of buffers */
+} mbox_payload_pool_t;
+
+/**
+ * @brief   Initialize a payload pool
+ *
+ * @param[out] pool         pool to initialize
+ * @param[in]  queue        free list, an array of at least @p numof
+ *                          messages, its size must be a power of two
+ * @param[in]  queue_size   number of messages in @p queue
+ * @param[in]  bufs         memory for the buffers, @p numof times
+ *                          @p buf_size bytes
+ * @param[in]  buf_size     size of a buffer
+ * @param[in]  numof        number of buffers
+ */
+void mbox_payload_pool_init(mbox_payload_pool_t *pool, msg_t *queue,
+                            unsigned queue_size, void *bufs, size_t buf_size,
+                            unsigned numof);
+
+/**
+ * @brief   Allocate a buffer, blocking
+ *
+ * Blocks until a buffer is available. The caller owns the buffer.
+ *
+ * @param[in] pool  pool to allocate from
+ *
+ * @return  the buffer, of pool's buf_size bytes
+ */
+static inline void *mbox_payload_alloc(mbox_payload_pool_t *pool)
+{
+    msg_t msg;
+
+    _mbox_get(&pool->free, &msg, BLOCKING);
+    return msg.content.ptr;
+}
+
+/**
+ * @brief   Allocate a buffer, non-blocking
+ *
+ * @param[in] pool  pool to allocate from
+ *
+ * @return  the buffer, of pool's buf_size bytes
+ * @return  NULL if all buffers are in use
+ */
+static inline void *mbox_payload_try_alloc(mbox_payload_pool_t *pool)
+{
+    msg_t msg;
+
+    return _mbox_get(&pool->free, &msg, NON_BLOCKING) ? msg.content.ptr : NULL;
+}
+
+/**
+ * @brief   Return a buffer to its pool
+ *
+ * Can be called from interrupt context. The caller must own the buffer.
+ *
+ * @param[in] pool  pool the buffer was allocated from
+ * @param[in] buf   the buffer
+ */
+void mbox_payload_free(mbox_payload_pool_t *pool, void *buf);
+
+/**
+ * @brief   Pass a buffer on through a mailbox, blocking
+ *
+ * Blocks until the mailbox has room. Afterwards, the buffer belongs to the
+ * thread that gets it from the mailbox.
+ *
+ * @param[in] mbox  mailbox to put the buffer into
+ * @param[in] buf   the buffer, must be owned by the caller
+ * @param[in] len   number of valid bytes in @p buf
+ */
+static inline void mbox_payload_put(mbox_t *mbox, void *buf, uint16_t len)
+{
+    msg_t msg = { .type = len, .content = { .ptr = buf } };
+
+    _mbox_put(mbox, &msg, BLOCKING);
+}
+
+/**
+ * @brief   Pass a buffer on through a mailbox, non-blocking
+ *
+ * Can be called from interrupt context.
+ *
+ * @param[in] mbox  mailbox to put the buffer into
+ * @param[in] buf   the buffer, must be owned by the caller
+ * @param[in] len   number of valid bytes in @p buf
+ *
+ * @return  1 if the buffer was passed on
+ * @return  0 if the mailbox is full, the caller still owns the buffer
+ */
+static inline int mbox_payload_try_put(mbox_t *mbox, void *buf, uint16_t len)
+{
+    msg_t msg = { .type = len, .content = { .ptr = buf } };
+
+    return _mbox_put(mbox, &msg, NON_BLOCKING);
+}
+
+/**
+ * @brief   Take a buffer from a mailbox, blocking
+ *
+ * The caller owns the returned buffer and has to free it to its pool.
+ *
+ * @param[in]  mbox mailbox to get the buffer from
+ * @param[out] len  number of valid bytes in the buffer, may be NULL
+ *
+ * @return  the buffer
+ */
+static inline void *mbox_payload_get(mbox_t *mbox, uint16_t *len)
+{
+    msg_t msg;
+
+    _mbox_get(mbox, &msg, BLOCKING);
+    if (len) {
+        *len = msg.type;
+    }
+    return msg.content.ptr;
+}
+
+/**
+ * @brief   Take a buffer from a mailbox, non-blocking
+ *
+ * @param[in]  mbox mailbox to get the buffer from
+ * @param[out] len  number of valid bytes in the buffer, may be NULL
+ *
+ * @return  the buffer, the caller owns it
+ * @return  NULL if the mailbox is empty
+ */
+static inline void *mbox_payload_try_get(mbox_t *mbox, uint16_t *len)
+{
+    msg_t msg;
+
+    if (!_mbox_get(mbox, &msg, NON_BLOCKING)) {
+        return NULL;
+    }
+    if (len) {
+        *len = msg.type;
+    }
+    return msg.content.ptr;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBOX_PAYLOAD_H */
+/** @} */
@@ -272,6 +272,27 @@ int msg_send_to_self(msg_t *m);
  */
 int msg_send_int(msg_t *m, kernel_pid_t target_pid);
 
+/**
+ * @brief Send multiple messages to the same thread.
+ *
+ * All messages are delivered under a single interrupt lock, and the target
+ * is scheduled at most once: if it waits in msg_receive() or
+ * msg_receive_bulk(), the first message is handed over directly and the
+ * others are put into its message queue. This function never blocks, the
+ * messages that do not fit into the target's queue are not sent.
+ *
+ * Can be called from interrupt context, ``m[i].sender_pid`` is set for all
+ * @p num messages.
+ *
+ * @param[in] m             Array of @p num messages.
+ * @param[in] num           Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread.
+ *
+ * @return the number of sent messages, a prefix of @p m
+ * @return -1, on error (invalid PID)
+ */
+int msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Test if the message was sent inside an ISR.
  * @see msg_send_int()
@@ -309,6 +330,33 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive multiple messages.
+ *
+ * Blocks until at least one message is available, then takes up to @p num
+ * messages from the message queue and from threads blocked sending to this
+ * thread, under a single interrupt lock. Woken up senders cause at most one
+ * context switch.
+ *
+ * @param[out] m    Array of at least @p num messages, must not be NULL.
+ * @param[in] num   Maximum number of messages to receive, must be > 0.
+ *
+ * @return  number of received messages, at least 1.
+ */
+int msg_receive_bulk(msg_t *m, unsigned num);
+
+/**
+ * @brief Try to receive multiple messages.
+ *
+ * Like msg_receive_bulk(), but does not block if no message is available.
+ *
+ * @param[out] m    Array of at least @p num messages, must not be NULL.
+ * @param[in] num   Maximum number of messages to receive, must be > 0.
+ *
+ * @return  number of received messages, 0 if none was available.
+ */
+int msg_try_receive_bulk(msg_t *m, unsigned num);
+
 /**
  * @brief Send a message, block until reply received.
  *
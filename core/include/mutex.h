@@ -11,6 +11,20 @@
  * @defgroup    core_sync Synchronization
  * @brief       Mutex for thread synchronization
  * @ingroup     core
+ *
+ * With the `core_mutex_priority_inheritance` module, a thread holding a mutex
+ * runs with the priority of the highest priority thread waiting for it, so
+ * medium priority threads cannot delay a high priority thread indefinitely
+ * by preempting the holder (priority inversion). The boost follows chains of
+ * threads blocked on mutexes held by other blocked threads, and a thread
+ * holding several mutexes keeps the highest priority any of them requires.
+ * When it unlocks a mutex, it drops back to the priority still required by
+ * the other mutexes it holds, or to its own priority.
+ *
+ * Only mutexes locked by a thread are tracked; a mutex locked in interrupt
+ * context or initialized with @ref MUTEX_INIT_LOCKED has no owner that could
+ * be boosted.
+ *
  * @{
  *
  * @file
@@ -24,6 +38,7 @@
 
 #include <stddef.h>
 
+#include "kernel_types.h"
 #include "list.h"
 
 #ifdef __cplusplus
@@ -33,25 +48,46 @@
 /**
  * @brief Mutex structure. Must never be modified by the user.
  */
-typedef struct {
+typedef struct mutex {
     /**
      * @brief   The process waiting queue of the mutex. **Must never be changed
      *          by the user.**
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The thread holding the mutex, KERNEL_PID_UNDEF if the mutex is
+     *          unlocked or was locked from interrupt context
+     * @internal
+     */
+    kernel_pid_t owner;
+    /**
+     * @brief   Next mutex held by the owner that other threads wait for
+     * @internal
+     */
+    struct mutex *next_contended;
+#endif
 } mutex_t;
 
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF, NULL }
+#else
 #define MUTEX_INIT { { NULL } }
+#endif
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF, NULL }
+#else
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @cond INTERNAL
@@ -72,6 +108,10 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+    mutex->next_contended = NULL;
+#endif
 }
 
 /**
@@ -113,6 +153,39 @@ static inline void mutex_lock(mutex_t *mutex)
     _mutex_lock(mutex, 1);
 }
 
+/**
+ * @brief Maximum number of attempts of mutex_lock_adaptive() before blocking
+ */
+#ifndef MUTEX_ADAPTIVE_SPINS
+#define MUTEX_ADAPTIVE_SPINS    (100U)
+#endif
+
+/**
+ * @brief Locks a mutex, spinning for a short while before blocking.
+ *
+ * Polls the mutex up to @ref MUTEX_ADAPTIVE_SPINS times and only takes it
+ * (with interrupts disabled) when it looks unlocked, then falls back to
+ * mutex_lock(). If the mutex is released while spinning, the caller avoids
+ * being queued and the two context switches of blocking.
+ *
+ * @note    With a single CPU the holder cannot run while the caller spins,
+ *          so this only pays off if the mutex is unlocked from interrupt
+ *          context, e.g., by a timer or a driver ISR that finishes shortly.
+ *          Use mutex_lock() for mutexes that are held by other threads.
+ *
+ * @param[in] mutex Mutex object to lock. Has to be initialized first. Must not be NULL.
+ */
+static inline void mutex_lock_adaptive(mutex_t *mutex)
+{
+    for (unsigned i = 0; i < MUTEX_ADAPTIVE_SPINS; i++) {
+        if ((((volatile list_node_t *)&mutex->queue)->next == NULL) &&
+            _mutex_lock(mutex, 0)) {
+            return;
+        }
+    }
+    _mutex_lock(mutex, 1);
+}
+
 /**
  * @brief Unlocks the mutex.
  *
@@ -127,6 +200,22 @@ void mutex_unlock(mutex_t *mutex);
  */
 void mutex_unlock_and_sleep(mutex_t *mutex);
 
+/**
+ * @brief Stops a thread from waiting for a mutex
+ *
+ * Takes the thread out of the wait queue without giving it the mutex, e.g.
+ * when waiting for the mutex timed out. With priority inheritance, the owner
+ * of the mutex drops the priority it inherited from that thread. The caller
+ * has to wake up the thread.
+ *
+ * @param[in] mutex Mutex object the thread waits for, must not be NULL.
+ * @param[in] pid   The waiting thread.
+ *
+ * @return  1 if the thread was waiting for @p mutex
+ * @return  0 if it was not, e.g. because it got the mutex meanwhile
+ */
+int mutex_cancel_wait(mutex_t *mutex, kernel_pid_t pid);
+
 #ifdef __cplusplus
 }
 #endif
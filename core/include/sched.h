@@ -104,6 +104,20 @@ typedef struct _thread thread_t;
 #define SCHED_PRIO_LEVELS 16
 #endif
 
+#if defined(MODULE_SCHED_EDF) || defined(DOXYGEN)
+/**
+ * @brief   Priority level used for earliest deadline first scheduling
+ *
+ * The run queue of this level is ordered by thread_t::edf_deadline instead
+ * of round-robin, see @ref sys_sched_edf. The level is reserved for EDF
+ * threads. By default, it is the highest priority, so EDF threads run before
+ * all threads with a fixed priority.
+ */
+#ifndef SCHED_EDF_PRIORITY
+#define SCHED_EDF_PRIORITY  (0U)
+#endif
+#endif
+
 /**
  * @brief   Triggers the scheduler to schedule the next thread
  * @returns 1 if sched_active_thread/sched_active_pid was changed, 0 otherwise.
@@ -119,6 +133,40 @@ int sched_run(void);
  */
 void sched_set_status(thread_t *process, unsigned int status);
 
+/**
+ * @brief   Change the priority of a thread
+ *
+ * If the thread is on a run queue, it is moved to the run queue of the new
+ * priority. This does not yield, the caller has to call sched_switch() or
+ * thread_yield_higher() if the change requires rescheduling.
+ *
+ * @pre     Interrupts are disabled
+ *
+ * @param[in]   thread      thread to change the priority of
+ * @param[in]   priority    new priority, must be < @ref SCHED_PRIO_LEVELS
+ */
+void sched_change_priority(thread_t *thread, uint8_t priority);
+
+#if defined(MODULE_SCHED_EDF) || defined(DOXYGEN)
+/**
+ * @brief   Set the absolute deadline of a thread
+ *
+ * If the thread is queued on the EDF run queue, it is moved to its new
+ * position. Like sched_change_priority(), this does not yield.
+ *
+ * With `core_mutex_priority_inheritance`, this sets the deadline including
+ * what the thread inherited from EDF threads waiting for its mutexes,
+ * thread_t::edf_base_deadline is left alone.
+ *
+ * @pre     Interrupts are disabled
+ *
+ * @param[in]   thread      thread to change the deadline of
+ * @param[in]   deadline    new deadline, compared in wrap-around safe
+ *                          32-bit arithmetic
+ */
+void sched_set_deadline(thread_t *thread, uint32_t deadline);
+#endif
+
 /**
  * @brief       Yield if approriate.
  *
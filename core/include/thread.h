@@ -189,6 +189,21 @@ struct _thread {
     msg_t *msg_array;               /**< memory holding messages        */
 #endif
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    uint8_t base_priority;          /**< priority without inheritance   */
+    struct mutex *mutex_contended;  /**< mutexes locked by this thread
+                                         that others wait for           */
+    struct mutex *mutex_blocked;    /**< mutex this thread waits for    */
+#endif
+
+#ifdef MODULE_SCHED_EDF
+    uint32_t edf_deadline;          /**< absolute deadline, orders the
+                                         EDF run queue                  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    uint32_t edf_base_deadline;     /**< deadline without inheritance   */
+#endif
+#endif
+
 #if defined(DEVELHELP) || defined(SCHED_TEST_STACK) || defined(MODULE_MPU_STACK_GUARD)
     char *stack_start;              /**< thread's stack start address   */
 #endif
@@ -310,6 +325,8 @@ struct _thread {
  * see @ref core_thread.
  *
  * @note Avoid assigning the same priority to two or more threads.
+ * @note With the `sched_edf` module, @ref SCHED_EDF_PRIORITY is reserved for
+ *       threads that called sched_edf_enter() and must not be used here.
  * @note Creating threads from within an ISR is currently supported, however it
  *       is considered to be a bad programming practice and we strongly
  *       discourage you from doing so.
@@ -51,6 +51,7 @@
 #define THREAD_FLAG_H
 
 #include "kernel_types.h"
+#include "msg.h"
 #include "sched.h"  /* for thread_t typedef */
 
 #ifdef __cplusplus
@@ -61,7 +62,9 @@
  * @name reserved thread flags
  * @{
  */
-#define THREAD_FLAG_MSG_WAITING      (0x1<<15)
+#define THREAD_FLAG_MSG_WAITING      (0x1<<15)  /**< a message was queued for
+                                                 *   the thread, see
+                                                 *   thread_flags_msg_wait_any() */
 #define THREAD_FLAG_MUTEX_UNLOCKED   (0x1<<14)
 #define THREAD_FLAG_TIMEOUT          (0x1<<13)
 /** @} */
@@ -132,6 +135,30 @@ thread_flags_t thread_flags_wait_all(thread_flags_t mask);
  */
 thread_flags_t thread_flags_wait_one(thread_flags_t mask);
 
+/**
+ * @brief Wait for any flag in mask to become set or for a message (blocking)
+ *
+ * Returns as soon as any of the flags in @p mask is set, or a message can be
+ * received. Flags take precedence: if flags are set, they are cleared and
+ * returned and pending messages are left for the next call. Otherwise, a
+ * message is received into @p msg and 0 is returned.
+ *
+ * This allows a thread to receive messages (e.g., netapi requests) and, at
+ * the same time, be signalled from interrupts with thread_flags_set(), which
+ * cannot fail and coalesces repeated events, unlike msg_send_int() into a
+ * possibly full message queue.
+ *
+ * @note    Only available if the `core_msg` module is used.
+ *
+ * @param[in]   mask    mask of flags to wait for, must not contain
+ *                      @ref THREAD_FLAG_MSG_WAITING
+ * @param[out]  msg     the received message, if 0 is returned
+ *
+ * @returns     flags that caused return/wakeup, they are cleared
+ * @returns     0 if a message was received
+ */
+thread_flags_t thread_flags_msg_wait_any(thread_flags_t mask, msg_t *msg);
+
 /**
  * @brief Possibly Wake up thread waiting for flags
  *
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_mbox_payload
+ * @{
+ *
+ * @file
+ * @brief       Mailbox payload pool implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "mbox_payload.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+void mbox_payload_pool_init(mbox_payload_pool_t *pool, msg_t *queue,
+                            unsigned queue_size, void *bufs, size_t buf_size,
+                            unsigned numof)
+{
+    assert(numof <= queue_size);
+
+    mbox_init(&pool->free, queue, queue_size);
+    pool->bufs = bufs;
+    pool->buf_size = buf_size;
+    pool->numof = numof;
+
+    for (unsigned i = 0; i < numof; i++) {
+        mbox_payload_free(pool, pool->bufs + (i * buf_size));
+    }
+}
+
+void mbox_payload_free(mbox_payload_pool_t *pool, void *buf)
+{
+    msg_t msg = { .content = { .ptr = buf } };
+
+    /* catches buffers from other pools and pointers into a buffer */
+    assert(((uint8_t *)buf >= pool->bufs) &&
+           ((uint8_t *)buf < (pool->bufs + (pool->numof * pool->buf_size))) &&
+           ((((uint8_t *)buf - pool->bufs) % pool->buf_size) == 0));
+
+    DEBUG("mbox_payload: freeing %p\n", buf);
+    /* the free list has room for all buffers, so this cannot fail unless a
+     * buffer is freed twice */
+    int res = _mbox_put(&pool->free, &msg, NON_BLOCKING);
+    assert(res == 1);
+    (void)res;
+}
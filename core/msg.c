@@ -29,6 +29,13 @@
 #include "thread.h"
 #include "irq.h"
 #include "cib.h"
+#ifdef MODULE_CORE_THREAD_FLAGS
+#include "thread_flags.h"
+#endif
+
+#ifdef MODULE_SCHEDTRACE
+#include "schedtrace.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -37,6 +44,40 @@
 static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned state);
 
+/* tells a thread waiting in thread_flags_msg_wait_any() that a message is
+ * available, returns 1 if it was woken up */
+static inline int _flag_msg_waiting(thread_t *target)
+{
+#ifdef MODULE_CORE_THREAD_FLAGS
+    target->flags |= THREAD_FLAG_MSG_WAITING;
+    return thread_flags_wake(target);
+#else
+    (void)target;
+    return 0;
+#endif
+}
+
+/* records a message handed over from sender to target */
+static inline void _trace_send(kernel_pid_t sender, kernel_pid_t target)
+{
+#ifdef MODULE_SCHEDTRACE
+    schedtrace_add(SCHEDTRACE_MSG_SEND, sender, target);
+#else
+    (void)sender;
+    (void)target;
+#endif
+}
+
+/* records a message from sender taken by the running thread */
+static inline void _trace_receive(kernel_pid_t sender)
+{
+#ifdef MODULE_SCHEDTRACE
+    schedtrace_add(SCHEDTRACE_MSG_RECEIVE, sched_active_pid, sender);
+#else
+    (void)sender;
+#endif
+}
+
 static int queue_msg(thread_t *target, const msg_t *m)
 {
     int n = cib_put(&(target->msg_queue));
@@ -106,10 +147,16 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned sta
             DEBUG("msg_send() %s:%i: Target %" PRIkernel_pid
                   " has a msg_queue. Queueing message.\n", RIOT_FILE_RELATIVE,
                   __LINE__, target_pid);
+            _trace_send(me->pid, target_pid);
+            int woken = _flag_msg_waiting(target);
+            uint16_t target_prio = target->priority;
             irq_restore(state);
             if (me->status == STATUS_REPLY_BLOCKED) {
                 thread_yield_higher();
             }
+            else if (woken) {
+                sched_switch(target_prio);
+            }
             return 1;
         }
 
@@ -137,6 +184,9 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned sta
         sched_set_status((thread_t*) me, newstatus);
 
         thread_add_to_list(&(target->msg_waiters), me);
+        _flag_msg_waiting(target);
+        /* the target takes the message before this thread runs again */
+        _trace_send(me->pid, target_pid);
 
         irq_restore(state);
         thread_yield_higher();
@@ -152,6 +202,7 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned sta
         msg_t *target_message = (msg_t*) target->wait_data;
         *target_message = *m;
         sched_set_status(target, STATUS_PENDING);
+        _trace_send(me->pid, target_pid);
 
         irq_restore(state);
         thread_yield_higher();
@@ -196,16 +247,76 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
         msg_t *target_message = (msg_t*) target->wait_data;
         *target_message = *m;
         sched_set_status(target, STATUS_PENDING);
+        _trace_send(KERNEL_PID_ISR, target_pid);
 
         sched_context_switch_request = 1;
         return 1;
     }
     else {
         DEBUG("msg_send_int: Receiver not waiting.\n");
-        return (queue_msg(target, m));
+        int res = queue_msg(target, m);
+        if (res) {
+            _trace_send(KERNEL_PID_ISR, target_pid);
+            if (_flag_msg_waiting(target)) {
+                sched_context_switch_request = 1;
+            }
+        }
+        return res;
     }
 }
 
+int msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+#ifdef DEVELHELP
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("msg_send_bulk(): target_pid is invalid, continuing anyways\n");
+    }
+#endif /* DEVELHELP */
+
+    kernel_pid_t sender_pid = irq_is_in() ? KERNEL_PID_ISR : sched_active_pid;
+    unsigned state = irq_disable();
+    thread_t *target = (thread_t *) sched_threads[target_pid];
+
+    if (target == NULL) {
+        DEBUG("msg_send_bulk(): target thread does not exist\n");
+        irq_restore(state);
+        return -1;
+    }
+
+    unsigned sent = 0;
+    bool wake = false;
+
+    for (unsigned i = 0; i < num; i++) {
+        m[i].sender_pid = sender_pid;
+    }
+    if (num && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("msg_send_bulk: Direct msg copy from %" PRIkernel_pid " to %"
+              PRIkernel_pid ".\n", sender_pid, target_pid);
+        /* the first message goes straight to the receiver, the others are
+         * queued and picked up by msg_receive_bulk() before it returns */
+        *((msg_t *) target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        wake = true;
+        sent++;
+    }
+    while ((sent < num) && queue_msg(target, &m[sent])) {
+        sent++;
+    }
+    if (sent && !wake) {
+        wake = _flag_msg_waiting(target);
+    }
+    for (unsigned i = 0; i < sent; i++) {
+        _trace_send(sender_pid, target_pid);
+    }
+
+    uint16_t target_prio = target->priority;
+    irq_restore(state);
+    if (wake) {
+        sched_switch(target_prio);
+    }
+    return sent;
+}
+
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(sched_active_pid != target_pid);
@@ -218,7 +329,11 @@ int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
      * overwritten if the target is not in RECEIVE_BLOCKED */
     *reply = *m;
     /* msg_send blocks until reply received */
-    return _msg_send(reply, target_pid, true, state);
+    int res = _msg_send(reply, target_pid, true, state);
+    if (res == 1) {
+        _trace_receive(target_pid);
+    }
+    return res;
 }
 
 int msg_reply(msg_t *m, msg_t *reply)
@@ -241,6 +356,7 @@ int msg_reply(msg_t *m, msg_t *reply)
     msg_t *target_message = (msg_t*) target->wait_data;
     *target_message = *reply;
     sched_set_status(target, STATUS_PENDING);
+    _trace_send(sched_active_pid, target->pid);
     uint16_t target_prio = target->priority;
     irq_restore(state);
     sched_switch(target_prio);
@@ -261,18 +377,27 @@ int msg_reply_int(msg_t *m, msg_t *reply)
     msg_t *target_message = (msg_t*) target->wait_data;
     *target_message = *reply;
     sched_set_status(target, STATUS_PENDING);
+    _trace_send(KERNEL_PID_ISR, target->pid);
     sched_context_switch_request = 1;
     return 1;
 }
 
+static inline int _msg_receive_trace(msg_t *m, int res)
+{
+    if (res == 1) {
+        _trace_receive(m->sender_pid);
+    }
+    return res;
+}
+
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    return _msg_receive_trace(m, _msg_receive(m, 0));
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    return _msg_receive_trace(m, _msg_receive(m, 1));
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -361,6 +486,101 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+/**
+ * @brief   Take up to @p num messages from the queue and from waiting senders
+ *
+ * Must be called with interrupts disabled. Senders whose message got taken
+ * are woken up, @p prio is lowered to the highest priority of those.
+ */
+static unsigned _msg_receive_many(thread_t *me, msg_t *m, unsigned num,
+                                  uint16_t *prio)
+{
+    unsigned n = 0;
+
+    while ((n < num) && me->msg_array) {
+        int queue_index = cib_get(&(me->msg_queue));
+        if (queue_index < 0) {
+            break;
+        }
+        m[n++] = me->msg_array[queue_index];
+    }
+
+    list_node_t *next;
+    while ((next = me->msg_waiters.next) != NULL) {
+        msg_t *dest;
+        if (n < num) {
+            dest = &m[n++];
+        }
+        else {
+            /* move waiting messages into the just freed queue space */
+            int queue_index = me->msg_array ? cib_put(&(me->msg_queue)) : -1;
+            if (queue_index < 0) {
+                break;
+            }
+            dest = &me->msg_array[queue_index];
+        }
+        list_remove_head(&me->msg_waiters);
+
+        thread_t *sender = container_of((clist_node_t*)next, thread_t, rq_entry);
+        *dest = *((msg_t *) sender->wait_data);
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < *prio) {
+                *prio = sender->priority;
+            }
+        }
+    }
+
+    return n;
+}
+
+static int _msg_receive_bulk(msg_t *m, unsigned num, int block)
+{
+    assert(num > 0);
+
+    thread_t *me = (thread_t *) sched_active_thread;
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned state = irq_disable();
+    unsigned n = _msg_receive_many(me, m, num, &sender_prio);
+
+    if (n == 0) {
+        if (!block) {
+            irq_restore(state);
+            return 0;
+        }
+        DEBUG("_msg_receive_bulk(): %" PRIkernel_pid ": No msg in queue. "
+              "Going blocked.\n", sched_active_pid);
+        me->wait_data = (void *) m;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied the first message, a bulk sender queued the others */
+        state = irq_disable();
+        n = 1 + _msg_receive_many(me, m + 1, num - 1, &sender_prio);
+    }
+
+    irq_restore(state);
+    for (unsigned i = 0; i < n; i++) {
+        _trace_receive(m[i].sender_pid);
+    }
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+    return n;
+}
+
+int msg_receive_bulk(msg_t *m, unsigned num)
+{
+    return _msg_receive_bulk(m, num, 1);
+}
+
+int msg_try_receive_bulk(msg_t *m, unsigned num)
+{
+    return _msg_receive_bulk(m, num, 0);
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
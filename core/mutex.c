@@ -31,9 +31,154 @@
 #include "thread.h"
 #include "list.h"
 
+#ifdef MODULE_SCHEDTRACE
+#include "schedtrace.h"
+#endif
+
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+static inline thread_t *_owner(mutex_t *mutex)
+{
+    if (mutex->owner == KERNEL_PID_UNDEF) {
+        return NULL;
+    }
+    return (thread_t *)sched_threads[mutex->owner];
+}
+
+static inline thread_t *_first_waiter(mutex_t *mutex)
+{
+    list_node_t *head = mutex->queue.next;
+
+    if ((head == NULL) || (head == MUTEX_LOCKED)) {
+        return NULL;
+    }
+    return container_of((clist_node_t*)head, thread_t, rq_entry);
+}
+
+/* Only the mutexes other threads wait for are linked to their owner, as only
+ * those raise its priority. A mutex without waiters may go out of scope
+ * while it is locked (e.g., in xtimer_usleep()), so its owner must not keep
+ * a reference to it. */
+static void _link(mutex_t *mutex, thread_t *owner)
+{
+    mutex->next_contended = owner->mutex_contended;
+    owner->mutex_contended = mutex;
+}
+
+static void _unlink(mutex_t *mutex, thread_t *owner)
+{
+    for (mutex_t **m = &owner->mutex_contended; *m; m = &(*m)->next_contended) {
+        if (*m == mutex) {
+            *m = mutex->next_contended;
+            break;
+        }
+    }
+    mutex->next_contended = NULL;
+}
+
+/* the priority a thread needs for the mutexes it holds */
+static uint8_t _inherited_priority(thread_t *thread)
+{
+    uint8_t prio = thread->base_priority;
+
+    for (mutex_t *m = thread->mutex_contended; m; m = m->next_contended) {
+        thread_t *waiter = _first_waiter(m);
+        if (waiter && (waiter->priority < prio)) {
+            prio = waiter->priority;
+        }
+    }
+    return prio;
+}
+
+#ifdef MODULE_SCHED_EDF
+/* the deadline a thread needs for the mutexes it holds, that is the earliest
+ * one of its own (if it is an EDF thread) and of the EDF threads waiting */
+static uint32_t _inherited_deadline(thread_t *thread)
+{
+    uint32_t deadline = thread->edf_base_deadline;
+    int edf = (thread->base_priority == SCHED_EDF_PRIORITY);
+
+    for (mutex_t *m = thread->mutex_contended; m; m = m->next_contended) {
+        /* the wait queue is sorted by priority, EDF waiters come first */
+        for (list_node_t *n = m->queue.next; n; n = n->next) {
+            thread_t *waiter = container_of((clist_node_t*)n, thread_t,
+                                            rq_entry);
+            if (waiter->priority != SCHED_EDF_PRIORITY) {
+                break;
+            }
+            if (!edf || ((int32_t)(waiter->edf_deadline - deadline) < 0)) {
+                deadline = waiter->edf_deadline;
+                edf = 1;
+            }
+        }
+    }
+    return deadline;
+}
+#endif
+
+/* sets the priority (and deadline) thread needs for the mutexes it holds,
+ * returns 0 if nothing changed */
+static int _inherit(thread_t *thread)
+{
+    uint8_t prio = _inherited_priority(thread);
+    int changed = (prio != thread->priority);
+
+#ifdef MODULE_SCHED_EDF
+    uint32_t deadline = _inherited_deadline(thread);
+    if (deadline != thread->edf_deadline) {
+        /* first, so an EDF run queue it moves to is sorted by it */
+        sched_set_deadline(thread, deadline);
+        changed = 1;
+    }
+#endif
+    if (prio != thread->priority) {
+        DEBUG("PID[%" PRIkernel_pid "]: inherits priority %" PRIu16 "\n",
+              thread->pid, (uint16_t)prio);
+        sched_change_priority(thread, prio);
+    }
+    return changed;
+}
+
+/* recompute the priority of the owner of mutex, and of the owner of the
+ * mutex that one waits for, and so on */
+static void _update_owner(mutex_t *mutex)
+{
+    thread_t *owner;
+
+    while (mutex && (owner = _owner(mutex))) {
+        if (!_inherit(owner)) {
+            break;
+        }
+
+        mutex = owner->mutex_blocked;
+        if (mutex) {
+            /* keep the wait queue sorted by priority */
+            list_remove(&mutex->queue, (list_node_t*)&owner->rq_entry);
+            thread_add_to_list(&mutex->queue, owner);
+        }
+    }
+}
+
+/* called on unlock after process was taken from the wait queue */
+static void _pass_ownership(mutex_t *mutex, thread_t *process)
+{
+    thread_t *owner = _owner(mutex);
+
+    if (owner) {
+        _unlink(mutex, owner);
+        _inherit(owner);
+    }
+    mutex->owner = process->pid;
+    process->mutex_blocked = NULL;
+    if (mutex->queue.next != MUTEX_LOCKED) {
+        _link(mutex, process);
+        _update_owner(mutex);
+    }
+}
+#endif
+
 int _mutex_lock(mutex_t *mutex, int blocking)
 {
     unsigned irqstate = irq_disable();
@@ -43,6 +188,9 @@ int _mutex_lock(mutex_t *mutex, int blocking)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        mutex->owner = irq_is_in() ? KERNEL_PID_UNDEF : sched_active_pid;
+#endif
         DEBUG("PID[%" PRIkernel_pid "]: mutex_wait early out.\n",
               sched_active_pid);
         irq_restore(irqstate);
@@ -53,13 +201,27 @@ int _mutex_lock(mutex_t *mutex, int blocking)
         DEBUG("PID[%" PRIkernel_pid "]: Adding node to mutex queue: prio: %"
               PRIu32 "\n", sched_active_pid, (uint32_t)me->priority);
         sched_set_status(me, STATUS_MUTEX_BLOCKED);
+#ifdef MODULE_SCHEDTRACE
+        schedtrace_add(SCHEDTRACE_MUTEX_BLOCK, me->pid,
+                       (uint16_t)(uintptr_t)mutex);
+#endif
         if (mutex->queue.next == MUTEX_LOCKED) {
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+            thread_t *owner = _owner(mutex);
+            if (owner) {
+                _link(mutex, owner);
+            }
+#endif
             mutex->queue.next = (list_node_t*)&me->rq_entry;
             mutex->queue.next->next = NULL;
         }
         else {
             thread_add_to_list(&mutex->queue, me);
         }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        me->mutex_blocked = mutex;
+        _update_owner(mutex);
+#endif
         irq_restore(irqstate);
         thread_yield_higher();
         /* We were woken up by scheduler. Waker removed us from queue.
@@ -87,6 +249,9 @@ void mutex_unlock(mutex_t *mutex)
 
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        mutex->owner = KERNEL_PID_UNDEF;
+#endif
         /* the mutex was locked and no thread was waiting for it */
         irq_restore(irqstate);
         return;
@@ -99,16 +264,57 @@ void mutex_unlock(mutex_t *mutex)
     DEBUG("mutex_unlock: waking up waiting thread %" PRIkernel_pid "\n",
           process->pid);
     sched_set_status(process, STATUS_PENDING);
+#ifdef MODULE_SCHEDTRACE
+    schedtrace_add(SCHEDTRACE_MUTEX_UNBLOCK, process->pid,
+                   (uint16_t)(uintptr_t)mutex);
+#endif
 
     if (!mutex->queue.next) {
         mutex->queue.next = MUTEX_LOCKED;
     }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    /* lowers our priority first if it was raised for this mutex, the woken
+     * up thread then has a higher one and sched_switch() yields to it */
+    _pass_ownership(mutex, process);
+#endif
 
     uint16_t process_priority = process->priority;
     irq_restore(irqstate);
     sched_switch(process_priority);
 }
 
+int mutex_cancel_wait(mutex_t *mutex, kernel_pid_t pid)
+{
+    unsigned irqstate = irq_disable();
+    thread_t *thread = (thread_t *)sched_threads[pid];
+
+    if ((thread == NULL) || (thread->status != STATUS_MUTEX_BLOCKED) ||
+        (mutex->queue.next == NULL) || (mutex->queue.next == MUTEX_LOCKED) ||
+        !list_remove(&mutex->queue, (list_node_t*)&thread->rq_entry)) {
+        irq_restore(irqstate);
+        return 0;
+    }
+
+    DEBUG("PID[%" PRIkernel_pid "]: stops waiting for mutex\n", pid);
+    if (!mutex->queue.next) {
+        mutex->queue.next = MUTEX_LOCKED;
+    }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->mutex_blocked = NULL;
+    thread_t *owner = _owner(mutex);
+    if (owner) {
+        if (mutex->queue.next == MUTEX_LOCKED) {
+            _unlink(mutex, owner);
+        }
+        /* drops what the owner (and the owner of the mutex it waits for,
+         * and so on) inherited from thread */
+        _update_owner(mutex);
+    }
+#endif
+    irq_restore(irqstate);
+    return 1;
+}
+
 void mutex_unlock_and_sleep(mutex_t *mutex)
 {
     DEBUG("PID[%" PRIkernel_pid "]: unlocking mutex. queue.next: 0x%08x, and "
@@ -118,6 +324,9 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     if (mutex->queue.next) {
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+            mutex->owner = KERNEL_PID_UNDEF;
+#endif
         }
         else {
             list_node_t *next = list_remove_head(&mutex->queue);
@@ -125,9 +334,16 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
                                              rq_entry);
             DEBUG("PID[%" PRIkernel_pid "]: waking up waiter.\n", process->pid);
             sched_set_status(process, STATUS_PENDING);
+#ifdef MODULE_SCHEDTRACE
+            schedtrace_add(SCHEDTRACE_MUTEX_UNBLOCK, process->pid,
+                           (uint16_t)(uintptr_t)mutex);
+#endif
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+            _pass_ownership(mutex, process);
+#endif
         }
     }
 
@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdint.h>
 
 #include "sched.h"
@@ -37,6 +38,10 @@
 #include "xtimer.h"
 #endif
 
+#ifdef MODULE_SCHEDTRACE
+#include "schedtrace.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -132,6 +137,11 @@ int __attribute__((used)) sched_run(void)
     }
 #endif
 
+#ifdef MODULE_SCHEDTRACE
+    schedtrace_add(SCHEDTRACE_SWITCH, next_thread->pid,
+                   active_thread ? active_thread->pid : KERNEL_PID_UNDEF);
+#endif
+
     next_thread->status = STATUS_RUNNING;
     sched_active_pid = next_thread->pid;
     sched_active_thread = (volatile thread_t *) next_thread;
@@ -158,13 +168,56 @@ void sched_register_cb(void (*callback)(uint32_t, uint32_t))
 }
 #endif
 
+#ifdef MODULE_SCHED_EDF
+/* keeps the EDF run queue sorted by deadline, FIFO for equal deadlines */
+static void _edf_insert(clist_node_t *runqueue, thread_t *thread)
+{
+    clist_node_t *last = runqueue->next;
+
+    if (last) {
+        clist_node_t *prev = last;
+        do {
+            thread_t *next = container_of(prev->next, thread_t, rq_entry);
+            if ((int32_t)(thread->edf_deadline - next->edf_deadline) < 0) {
+                /* insert in front of next, this might be the new head */
+                thread->rq_entry.next = prev->next;
+                prev->next = &(thread->rq_entry);
+                return;
+            }
+            prev = prev->next;
+        } while (prev != last);
+    }
+    clist_rpush(runqueue, &(thread->rq_entry));
+}
+
+void sched_set_deadline(thread_t *thread, uint32_t deadline)
+{
+    thread->edf_deadline = deadline;
+
+    if ((thread->priority == SCHED_EDF_PRIORITY) &&
+        (thread->status >= STATUS_ON_RUNQUEUE)) {
+        clist_node_t *runqueue = &sched_runqueues[SCHED_EDF_PRIORITY];
+        clist_remove(runqueue, &(thread->rq_entry));
+        _edf_insert(runqueue, thread);
+    }
+}
+#endif
+
 void sched_set_status(thread_t *process, unsigned int status)
 {
     if (status >= STATUS_ON_RUNQUEUE) {
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
             DEBUG("sched_set_status: adding thread %" PRIkernel_pid " to runqueue %" PRIu16 ".\n",
                   process->pid, process->priority);
-            clist_rpush(&sched_runqueues[process->priority], &(process->rq_entry));
+#ifdef MODULE_SCHED_EDF
+            if (process->priority == SCHED_EDF_PRIORITY) {
+                _edf_insert(&sched_runqueues[SCHED_EDF_PRIORITY], process);
+            }
+            else
+#endif
+            {
+                clist_rpush(&sched_runqueues[process->priority], &(process->rq_entry));
+            }
             runqueue_bitcache |= 1 << process->priority;
         }
     }
@@ -172,7 +225,18 @@ void sched_set_status(thread_t *process, unsigned int status)
         if (process->status >= STATUS_ON_RUNQUEUE) {
             DEBUG("sched_set_status: removing thread %" PRIkernel_pid " to runqueue %" PRIu16 ".\n",
                   process->pid, process->priority);
-            clist_lpop(&sched_runqueues[process->priority]);
+#ifdef MODULE_SCHED_EDF
+            if (process->priority == SCHED_EDF_PRIORITY) {
+                /* a thread with an earlier deadline might have been queued
+                 * in front of the running thread, e.g. by msg_send_receive() */
+                clist_remove(&sched_runqueues[process->priority],
+                             &(process->rq_entry));
+            }
+            else
+#endif
+            {
+                clist_lpop(&sched_runqueues[process->priority]);
+            }
 
             if (!sched_runqueues[process->priority].next) {
                 runqueue_bitcache &= ~(1 << process->priority);
@@ -183,6 +247,40 @@ void sched_set_status(thread_t *process, unsigned int status)
     process->status = status;
 }
 
+void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+    assert(priority < SCHED_PRIO_LEVELS);
+
+    if (thread->priority == priority) {
+        return;
+    }
+
+    DEBUG("sched_change_priority: thread %" PRIkernel_pid " %" PRIu16
+          " -> %" PRIu16 "\n", thread->pid, (uint16_t)thread->priority,
+          (uint16_t)priority);
+
+    if (thread->status >= STATUS_ON_RUNQUEUE) {
+        clist_remove(&sched_runqueues[thread->priority], &(thread->rq_entry));
+        if (!sched_runqueues[thread->priority].next) {
+            runqueue_bitcache &= ~(1 << thread->priority);
+        }
+        /* the running thread has to stay the head of its run queue */
+        if (thread == sched_active_thread) {
+            clist_lpush(&sched_runqueues[priority], &(thread->rq_entry));
+        }
+#ifdef MODULE_SCHED_EDF
+        else if (priority == SCHED_EDF_PRIORITY) {
+            _edf_insert(&sched_runqueues[priority], thread);
+        }
+#endif
+        else {
+            clist_rpush(&sched_runqueues[priority], &(thread->rq_entry));
+        }
+        runqueue_bitcache |= 1 << priority;
+    }
+    thread->priority = priority;
+}
+
 void sched_switch(uint16_t other_prio)
 {
     thread_t *active_thread = (thread_t *) sched_active_thread;
@@ -193,6 +291,14 @@ void sched_switch(uint16_t other_prio)
           ", other_prio=%" PRIu16 "\n",
           active_thread->pid, current_prio, on_runqueue, other_prio);
 
+#ifdef MODULE_SCHED_EDF
+    /* the other thread might have an earlier deadline, sched_run() picks
+     * the head of the (sorted) EDF run queue */
+    if ((current_prio == SCHED_EDF_PRIORITY) && (other_prio == current_prio)) {
+        on_runqueue = 0;
+    }
+#endif
+
     if (!on_runqueue || (current_prio > other_prio)) {
         if (irq_is_in()) {
             DEBUG("sched_switch: setting sched_context_switch_request.\n");
@@ -98,7 +98,14 @@ void thread_yield(void)
     unsigned old_state = irq_disable();
     thread_t *me = (thread_t *)sched_active_thread;
     if (me->status >= STATUS_ON_RUNQUEUE) {
+#ifdef MODULE_SCHED_EDF
+        /* the EDF run queue is ordered by deadline, not round-robin */
+        if (me->priority != SCHED_EDF_PRIORITY) {
+            clist_lpoprpush(&sched_runqueues[me->priority]);
+        }
+#else
         clist_lpoprpush(&sched_runqueues[me->priority]);
+#endif
     }
     irq_restore(old_state);
 
@@ -145,6 +152,10 @@ kernel_pid_t thread_create(char *stack, int stacksize, char priority, int flags,
     if (priority >= SCHED_PRIO_LEVELS) {
         return -EINVAL;
     }
+#ifdef MODULE_SCHED_EDF
+    /* EDF threads enter their level with sched_edf_enter() */
+    assert(priority != SCHED_EDF_PRIORITY);
+#endif
 
 #ifdef DEVELHELP
     int total_stacksize = stacksize;
@@ -223,8 +234,21 @@ kernel_pid_t thread_create(char *stack, int stacksize, char priority, int flags,
     cb->priority = priority;
     cb->status = 0;
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    cb->base_priority = priority;
+    cb->mutex_contended = NULL;
+    cb->mutex_blocked = NULL;
+#endif
+
     cb->rq_entry.next = NULL;
 
+#ifdef MODULE_SCHED_EDF
+    cb->edf_deadline = 0;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    cb->edf_base_deadline = 0;
+#endif
+#endif
+
 #ifdef MODULE_CORE_MSG
     cb->wait_data = NULL;
     cb->msg_waiters.next = NULL;
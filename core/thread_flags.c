@@ -19,6 +19,8 @@
  */
 
 
+#include <assert.h>
+
 #include "thread_flags.h"
 #include "irq.h"
 #include "thread.h"
@@ -98,6 +100,30 @@ thread_flags_t thread_flags_wait_all(thread_flags_t mask)
     return _thread_flags_clear_atomic(me, mask);
 }
 
+#ifdef MODULE_CORE_MSG
+thread_flags_t thread_flags_msg_wait_any(thread_flags_t mask, msg_t *msg)
+{
+    assert(!(mask & THREAD_FLAG_MSG_WAITING));
+
+    while (1) {
+        thread_flags_t flags = thread_flags_clear(mask);
+        if (flags) {
+            return flags;
+        }
+        /* message senders set THREAD_FLAG_MSG_WAITING after this point, so
+         * nothing is missed between trying to receive and going blocked */
+        thread_flags_clear(THREAD_FLAG_MSG_WAITING);
+        if (msg_try_receive(msg) == 1) {
+            return 0;
+        }
+        flags = thread_flags_wait_any(mask | THREAD_FLAG_MSG_WAITING) & mask;
+        if (flags) {
+            return flags;
+        }
+    }
+}
+#endif
+
 inline int __attribute__((always_inline)) thread_flags_wake(thread_t *thread)
 {
     unsigned wakeup = 0;
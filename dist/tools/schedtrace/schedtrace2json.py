@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Convert a RIOT scheduler trace (module `schedtrace`) into a Chrome trace.
+
+The input is either the binary export written by schedtrace_save() or the
+console output of the `schedtrace dump` shell command. The resulting JSON
+file can be loaded into chrome://tracing or https://ui.perfetto.dev.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+MAGIC = 0x43525452
+VERSION = 1
+
+SWITCH = 1
+MSG_SEND = 2
+MSG_RECEIVE = 3
+MUTEX_BLOCK = 4
+MUTEX_UNBLOCK = 5
+
+PID_ISR = "isr"
+
+
+def from_dump(text):
+    """Extracts the hex encoded export from a `schedtrace dump` log
+
+    The last dump in the log is used. Lines may carry a prefix (e.g. the
+    timestamps added by pyterm), only the last word of every line is used.
+    """
+    dumps = re.findall(r"schedtrace: begin\s*?\n(.*?)^[^\n]*schedtrace: end",
+                       text, re.S | re.M)
+    if not dumps:
+        sys.exit("error: no 'schedtrace dump' output found")
+    lines = [line.split()[-1] for line in dumps[-1].splitlines()
+             if line.strip()]
+    return bytes.fromhex("".join(lines))
+
+
+def parse(data):
+    """Returns (hz, isr_pid, {pid: name}, [(time, type, pid, arg), ...])"""
+    for order in "<>":
+        if struct.unpack_from(order + "I", data)[0] == MAGIC:
+            break
+    else:
+        sys.exit("error: not a schedtrace export")
+    _, version, event_size, numof, hz, threads, isr_pid = \
+        struct.unpack_from(order + "IBBHIBB2x", data)
+    if version != VERSION:
+        sys.exit("error: unsupported version %d" % version)
+    pos = struct.calcsize(order + "IBBHIBB2x")
+
+    names = {}
+    for _ in range(threads):
+        pid, length = struct.unpack_from("BB", data, pos)
+        pos += 2
+        names[pid] = data[pos:pos + length].decode(errors="replace")
+        pos += length
+
+    events = []
+    for _ in range(numof):
+        events.append(struct.unpack_from(order + "IBBH", data, pos))
+        pos += event_size
+    return hz, isr_pid, names, events
+
+
+def convert(hz, names, events, isr_pid):
+    """Turns the parsed trace into a list of Chrome trace events"""
+    trace = []
+    for pid, name in sorted(names.items()):
+        trace.append({"ph": "M", "name": "thread_name", "pid": 0, "tid": pid,
+                      "args": {"name": name or "pid %d" % pid}})
+
+    def name(pid):
+        if pid == isr_pid:
+            return PID_ISR
+        return names.get(pid) or str(pid)
+
+    base = events[0][0] if events else 0
+    running = None
+    for time, type_, pid, arg in events:
+        # timestamps are 32 bit and wrap around, 'base' keeps them monotonic
+        ts = ((time - base) & 0xffffffff) * 1e6 / hz
+        if type_ == SWITCH:
+            if running is not None:
+                trace.append({"ph": "E", "pid": 0, "tid": running, "ts": ts})
+            trace.append({"ph": "B", "pid": 0, "tid": pid, "ts": ts,
+                          "name": "running"})
+            running = pid
+            continue
+        if type_ == MSG_SEND:
+            label = "msg_send to %s" % name(arg)
+        elif type_ == MSG_RECEIVE:
+            label = "msg_receive from %s" % name(arg)
+        elif type_ == MUTEX_BLOCK:
+            label = "mutex 0x%04x block" % arg
+        elif type_ == MUTEX_UNBLOCK:
+            label = "mutex 0x%04x unblock" % arg
+        else:
+            label = "unknown event %d" % type_
+        trace.append({"ph": "i", "s": "t", "pid": 0, "ts": ts,
+                      "tid": running if pid == isr_pid else pid,
+                      "name": label})
+    if running is not None and events:
+        trace.append({"ph": "E", "pid": 0, "tid": running,
+                      "ts": ((events[-1][0] - base) & 0xffffffff) * 1e6 / hz})
+    return trace
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__)
+    p.add_argument("infile", help="binary export or 'schedtrace dump' log")
+    p.add_argument("outfile", nargs="?", help="JSON output (default: stdout)")
+    args = p.parse_args()
+
+    with open(args.infile, "rb") as f:
+        data = f.read()
+    if not data.startswith(struct.pack("<I", MAGIC)) and \
+       not data.startswith(struct.pack(">I", MAGIC)):
+        data = from_dump(data.decode(errors="replace"))
+
+    hz, isr_pid, names, events = parse(data)
+    trace = {"traceEvents": convert(hz, names, events, isr_pid),
+             "displayTimeUnit": "ns"}
+
+    if args.outfile:
+        with open(args.outfile, "w") as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -88,6 +88,14 @@
 #include "net/gcoap.h"
 #endif
 
+#ifdef MODULE_EVENT_THREAD
+#include "event/thread.h"
+#endif
+
+#ifdef MODULE_THREADSTAT
+#include "threadstat.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -120,6 +128,14 @@ void auto_init(void)
     extern void profiling_init(void);
     profiling_init();
 #endif
+#ifdef MODULE_THREADSTAT
+    DEBUG("Auto init threadstat.\n");
+    threadstat_init();
+#endif
+#ifdef MODULE_EVENT_THREAD
+    DEBUG("Auto init event_thread module.\n");
+    event_thread_init();
+#endif
 #ifdef MODULE_GNRC_PKTBUF
     DEBUG("Auto init gnrc_pktbuf module\n");
     gnrc_pktbuf_init();
@@ -323,6 +339,10 @@ void auto_init(void)
     extern void auto_init_adxl345(void);
     auto_init_adxl345();
 #endif
+#ifdef MODULE_THREADSTAT
+    extern void auto_init_threadstat(void);
+    auto_init_threadstat();
+#endif
 
 #endif /* MODULE_AUTO_INIT_SAUL */
 
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ *
+ */
+
+/*
+ * @ingroup     auto_init_saul
+ * @{
+ *
+ * @file
+ * @brief       Auto initialization of the CPU load SAUL entry
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#ifdef MODULE_THREADSTAT
+
+#include "log.h"
+#include "saul_reg.h"
+#include "threadstat.h"
+
+/**
+ * @brief   Memory for the registry entry
+ */
+static saul_reg_t saul_reg_entry = {
+    .name = "cpu",
+    .driver = &threadstat_saul_driver,
+};
+
+void auto_init_threadstat(void)
+{
+    LOG_DEBUG("[auto_init_saul] initializing CPU load\n");
+
+    saul_reg_add(&saul_reg_entry);
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_THREADSTAT */
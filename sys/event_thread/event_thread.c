@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event_thread
+ * @{
+ *
+ * @file
+ * @brief       Shared event thread implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "event/thread.h"
+
+event_queue_t event_thread_queue = EVENT_QUEUE_INIT_DETACHED;
+
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+static char _stack[EVENT_THREAD_STACKSIZE];
+
+static void *_event_thread(void *arg)
+{
+    (void)arg;
+
+    event_queue_claim(&event_thread_queue);
+    event_loop(&event_thread_queue);
+
+    /* never reached */
+    return NULL;
+}
+
+kernel_pid_t event_thread_init(void)
+{
+    if (_pid == KERNEL_PID_UNDEF) {
+        _pid = thread_create(_stack, sizeof(_stack), EVENT_THREAD_PRIO,
+                             THREAD_CREATE_STACKTEST, _event_thread, NULL,
+                             "event");
+    }
+    return _pid;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys
+ * @{
+ *
+ * @file
+ * @brief       C11 atomic types for headers shared between C and C++
+ *
+ * The stdatomic.h in GCC gives compilation errors with C++, see
+ * https://gcc.gnu.org/bugzilla/show_bug.cgi?id=60932. C++ code gets the
+ * types and memory orders from `<atomic>` instead, made available without
+ * namespace specifier. The atomic_*() functions are found through the types.
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef ATOMIC_COMPAT_H
+#define ATOMIC_COMPAT_H
+
+#ifdef __cplusplus
+#include <atomic>
+using std::atomic_int;
+using std::atomic_uint;
+using std::memory_order_relaxed;
+using std::memory_order_acquire;
+using std::memory_order_release;
+using std::memory_order_acq_rel;
+using std::memory_order_seq_cst;
+#else
+#include <stdatomic.h>
+#endif
+
+#endif /* ATOMIC_COMPAT_H */
+/** @} */
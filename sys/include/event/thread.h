@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_event_thread Shared event thread
+ * @ingroup     sys
+ * @brief       One thread that handles the events of many modules
+ *
+ * This module provides an @ref core_event "event queue" that is handled by a
+ * thread started from auto_init. Modules that only react to packets, timers
+ * or interrupts can post their work to @ref event_thread_queue instead of
+ * running their own thread. This saves a stack and a message queue per
+ * module, and hand-offs between modules on the same thread do not need a
+ * context switch.
+ *
+ * When this module is used, the following modules run on the shared thread
+ * instead of starting their own:
+ *
+ * - @ref net_gnrc_udp
+ * - @ref net_gcoap
+ *
+ * Handlers run one after another, so a handler must not block.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Shared event thread API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef EVENT_THREAD_H
+#define EVENT_THREAD_H
+
+#include "event.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Stack size of the event thread
+ *
+ * Must fit the deepest handler of all modules using the thread.
+ */
+#ifndef EVENT_THREAD_STACKSIZE
+#define EVENT_THREAD_STACKSIZE  (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the event thread
+ */
+#ifndef EVENT_THREAD_PRIO
+#define EVENT_THREAD_PRIO       (THREAD_PRIORITY_MAIN - 2)
+#endif
+
+/**
+ * @brief   The shared event queue
+ *
+ * Events can be posted before the thread was started.
+ */
+extern event_queue_t event_thread_queue;
+
+/**
+ * @brief   Start the event thread
+ *
+ * Called by auto_init, does nothing if the thread is running already.
+ *
+ * @return  PID of the event thread
+ */
+kernel_pid_t event_thread_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_THREAD_H */
+/** @} */
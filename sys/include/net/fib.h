@@ -11,6 +11,16 @@
  * @ingroup     net
  * @brief       FIB implementation
  *
+ * By default, lookups in single hop tables scan all entries. With the
+ * `fib_trie` module the entries are additionally indexed by a compressed
+ * binary (Patricia) trie over their destination addresses, so the longest
+ * prefix match takes O(address length) instead of O(number of entries).
+ * Expired entries are then removed by a timer-triggered sweep instead of on
+ * every lookup. The trie nodes come from a pool the owner of a table provides
+ * in fib_table_t::trie_pool, next to the entries. A table needs
+ * FIB_TRIE_POOL_SIZE() nodes of about `UNIVERSAL_ADDRESS_SIZE + 16` bytes,
+ * i.e. two per entry.
+ *
  * @{
  *
  * @file
@@ -465,6 +475,19 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
  */
 int fib_get_num_used_entries(fib_table_t *table);
 
+/**
+ * @brief returns the generation of the FIB table
+ *
+ * The generation changes whenever an entry is added, updated or removed, or
+ * when the lifetime of an entry expired. Results of fib_get_next_hop() can be
+ * cached as long as the generation stays the same.
+ *
+ * @param[in] table         the fib instance to check
+ *
+ * @return the current generation of @p table
+ */
+unsigned fib_get_generation(fib_table_t *table);
+
 /**
  * @brief Prints the kernel_pid_t for all registered RRPs
  */
@@ -24,6 +24,9 @@
 #include "kernel_types.h"
 #include "universal_address.h"
 #include "mutex.h"
+#ifdef MODULE_FIB_TRIE
+#include "xtimer.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,10 +38,40 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+struct fib_entry;
+
+#if defined(MODULE_FIB_TRIE) || defined(DOXYGEN)
+/**
+ * @brief Node of the longest-prefix-match trie of a FIB table
+ *
+ * @note  Only available with the `fib_trie` module and managed by the FIB.
+ */
+typedef struct fib_trie_node {
+    /** the sub-tries for the next bit being 0 or 1 */
+    struct fib_trie_node *child[2];
+    /** entries with exactly this prefix, NULL for pure branching nodes */
+    struct fib_entry *entries;
+    /** length of the prefix in bits, including the address size byte */
+    uint16_t len;
+    /** the address size followed by the prefix */
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+} fib_trie_node_t;
+
+/**
+ * @brief Number of trie nodes a FIB table with @p entries entries needs
+ *
+ * Every entry takes at most one node for its prefix and one node branching
+ * off to it.
+ *
+ * @note  Only available with the `fib_trie` module.
+ */
+#define FIB_TRIE_POOL_SIZE(entries)     (2 * (entries))
+#endif
+
 /**
  * @brief Container descriptor for a FIB entry
  */
-typedef struct {
+typedef struct fib_entry {
     /** interface ID */
     kernel_pid_t iface_id;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
@@ -51,6 +84,10 @@ typedef struct {
     uint32_t next_hop_flags;
     /** Pointer to the shared generic address */
     universal_address_container_t *next_hop;
+#if defined(MODULE_FIB_TRIE) || defined(DOXYGEN)
+    /** next entry with the same prefix in the trie */
+    struct fib_entry *trie_next;
+#endif
 } fib_entry_t;
 
 /**
@@ -133,6 +170,36 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+    /** incremented on every change of the entries, see fib_get_generation() */
+    volatile unsigned generation;
+#if !defined(MODULE_FIB_TRIE) || defined(DOXYGEN)
+    /** earliest lifetime of all entries, 0 if none expires.
+    *   Without the trie, entries expire lazily on lookup, so
+    *   fib_get_generation() checks this time-point instead.
+    */
+    uint64_t next_expiry;
+#endif
+#if defined(MODULE_FIB_TRIE) || defined(DOXYGEN)
+    /** root of the longest-prefix-match trie over the entries */
+    fib_trie_node_t *trie_root;
+    /** array holding the nodes of the trie, provided by the owner of the
+    *   table like the entries. A table needs
+    *   FIB_TRIE_POOL_SIZE(size) nodes, otherwise adding entries can fail
+    *   with -ENOMEM. A table used with the linear lookup does not pay for
+    *   the trie, since this pool only exists with the `fib_trie` module.
+    */
+    fib_trie_node_t *trie_pool;
+    /** the number of nodes in trie_pool */
+    size_t trie_pool_size;
+    /** unused trie nodes */
+    fib_trie_node_t *trie_free;
+    /** timer triggering the removal of expired entries */
+    xtimer_t trie_timer;
+    /** absolute time-point the timer is set to, 0 if unset */
+    uint64_t trie_next_expiry;
+    /** set by the timer if expired entries are to be removed */
+    volatile uint8_t trie_sweep;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
@@ -130,6 +130,14 @@
  * times out. We track the response with an entry in the
  * `_coap_state.open_reqs` array.
  *
+ * ### Running on the shared event thread ###
+ *
+ * With the @ref sys_event_thread "event_thread" module, gcoap does not start
+ * a thread of its own. Incoming packets and response timeouts are posted as
+ * events to the shared event thread, so resource and response handlers run
+ * there and must not block. gcoap_init() then returns the PID of the event
+ * thread.
+ *
  * @{
  *
  * @file
@@ -145,6 +153,10 @@
 #include "nanocoap.h"
 #include "xtimer.h"
 
+#ifdef MODULE_EVENT_THREAD
+#include "event/timeout.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -251,8 +263,14 @@ typedef struct {
     uint8_t hdr_buf[GCOAP_HEADER_MAXLEN];
                                         /**< Stores a copy of the request header */
     gcoap_resp_handler_t resp_handler;  /**< Callback for the response */
+#if defined(MODULE_EVENT_THREAD) || defined(DOXYGEN)
+    event_t timeout_event;              /**< Posted when the wait times out */
+    event_timeout_t response_timeout;   /**< Limits wait for response */
+#endif
+#if !defined(MODULE_EVENT_THREAD) || defined(DOXYGEN)
     xtimer_t response_timer;            /**< Limits wait for response */
     msg_t timeout_msg;                  /**< For response timer */
+#endif
 } gcoap_request_memo_t;
 
 /**
@@ -272,7 +290,7 @@ typedef struct {
  *
  * Must call once before first use.
  *
- * @return  PID of the gcoap thread on success.
+ * @return  PID of the gcoap thread (or of the event thread) on success.
  * @return  -EEXIST, if thread already has been created.
  * @return  -EINVAL, if the IP port already is in use.
  */
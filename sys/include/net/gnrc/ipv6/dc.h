@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_ipv6_dc  IPv6 destination cache
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Caches the next hop and the source address per destination
+ *
+ * For every unicast packet, @ref net_gnrc_ipv6 determines the next hop's
+ * link layer address from the FIB, the neighbor cache and the 6LoWPAN-ND
+ * paths, and selects a source address. With the `gnrc_ipv6_dc` module, the
+ * results are kept in a small cache, so packets of a flow skip these
+ * lookups.
+ *
+ * Instead of being updated, entries are invalidated by a generation: the sum
+ * of the generations of the neighbor cache, the IPv6 interfaces and the FIB.
+ * An entry is only valid as long as nothing changed since the lookup it was
+ * created from.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Destination cache definitions.
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef GNRC_IPV6_DC_H
+#define GNRC_IPV6_DC_H
+
+#include <stdint.h>
+
+#include "kernel_types.h"
+#include "net/ipv6/addr.h"
+#include "net/gnrc/ipv6/nc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The size of the destination cache
+ */
+#ifndef GNRC_IPV6_DC_SIZE
+#define GNRC_IPV6_DC_SIZE           (4)
+#endif
+
+/**
+ * @brief   Destination cache entry
+ */
+typedef struct {
+    ipv6_addr_t dst;                /**< destination address */
+    ipv6_addr_t src;                /**< selected source address, unspecified
+                                     *   if there is none */
+    unsigned generation;            /**< generation the entry was created in */
+    kernel_pid_t lookup_iface;      /**< interface the lookup was restricted
+                                     *   to, KERNEL_PID_UNDEF for any */
+    kernel_pid_t iface;             /**< outgoing interface, KERNEL_PID_UNDEF
+                                     *   if the entry is unused */
+    uint16_t mtu;                   /**< MTU towards the destination. There
+                                     *   is no Path MTU Discovery, so this is
+                                     *   the MTU of the outgoing interface */
+    uint8_t l2_addr[GNRC_IPV6_NC_L2_ADDR_MAX];  /**< link layer address of
+                                                 *   the next hop */
+    uint8_t l2_addr_len;            /**< length of gnrc_ipv6_dc_t::l2_addr */
+} gnrc_ipv6_dc_t;
+
+/**
+ * @brief   Gets the current generation
+ *
+ * Take the generation before a lookup that an entry is created from, so
+ * changes during the lookup invalidate the entry.
+ *
+ * @return  the current generation
+ */
+unsigned gnrc_ipv6_dc_generation(void);
+
+/**
+ * @brief   Searches for a valid entry
+ *
+ * @param[in] iface     interface the lookup is restricted to,
+ *                      KERNEL_PID_UNDEF for any
+ * @param[in] dst       a unicast destination address
+ *
+ * @return  the entry for @p dst and @p iface
+ * @return  NULL, if there is none or it is outdated
+ */
+gnrc_ipv6_dc_t *gnrc_ipv6_dc_get(kernel_pid_t iface, const ipv6_addr_t *dst);
+
+/**
+ * @brief   Adds an entry
+ *
+ * An outdated entry for @p dst and @p iface is reused, otherwise the entries
+ * are replaced in round-robin order. The caller fills in the lookup results.
+ *
+ * @param[in] iface         interface the lookup is restricted to,
+ *                          KERNEL_PID_UNDEF for any
+ * @param[in] dst           a unicast destination address
+ * @param[in] generation    result of gnrc_ipv6_dc_generation() before the
+ *                          lookup
+ *
+ * @return  the entry, with gnrc_ipv6_dc_t::src unspecified and no link
+ *          layer address
+ */
+gnrc_ipv6_dc_t *gnrc_ipv6_dc_add(kernel_pid_t iface, const ipv6_addr_t *dst,
+                                 unsigned generation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_IPV6_DC_H */
+/** @} */
@@ -44,6 +44,16 @@ extern "C" {
 #define GNRC_IPV6_NC_SIZE           (GNRC_NETIF_NUMOF * 8)
 #endif
 
+#ifndef GNRC_IPV6_NC_HASH_SIZE
+/**
+ * @brief   The number of hash buckets of the neighbor cache
+ *
+ * Entries are looked up by a hash of their IPv6 address, which takes
+ * O(GNRC_IPV6_NC_SIZE / GNRC_IPV6_NC_HASH_SIZE). Every bucket takes 2 bytes.
+ */
+#define GNRC_IPV6_NC_HASH_SIZE      (GNRC_IPV6_NC_SIZE)
+#endif
+
 #ifndef GNRC_IPV6_NC_L2_ADDR_MAX
 /**
  * @brief   The maximum size of a link layer address
@@ -168,14 +178,37 @@ typedef struct {
      */
 } gnrc_ipv6_nc_t;
 
+/**
+ * @brief   Generation of the neighbor cache
+ *
+ * Changes whenever an entry is added, removed, or changed, so results derived
+ * from the neighbor cache can be cached as long as it stays the same.
+ */
+extern volatile unsigned gnrc_ipv6_nc_generation;
+
 /**
  * @brief   Initializes neighbor cache
  */
 void gnrc_ipv6_nc_init(void);
 
+/**
+ * @brief   Marks the neighbor cache as changed
+ *
+ * Must be called after the state, the flags, the interface, or the link layer
+ * address of an entry were changed directly.
+ */
+static inline void gnrc_ipv6_nc_changed(void)
+{
+    gnrc_ipv6_nc_generation++;
+}
+
 /**
  * @brief   Adds a neighbor to the neighbor cache
  *
+ * If the neighbor cache is full, the least recently used entry in state
+ * @ref GNRC_IPV6_NC_STATE_STALE is replaced. Routers and registered entries
+ * (@ref GNRC_IPV6_NC_TYPE_REGISTERED) are never replaced.
+ *
  * @param[in] iface         PID to the interface where the neighbor is.
  * @param[in] ipv6_addr     IPv6 address of the neighbor. Must not be NULL.
  * @param[in] l2_addr       Link layer address of the neighbor. NULL if unknown.
@@ -354,11 +354,31 @@ typedef struct {
 #endif
 } gnrc_ipv6_netif_t;
 
+/**
+ * @brief   Generation of the IPv6 interfaces
+ *
+ * Changes whenever an interface is added or removed, or an address, its
+ * flags or lifetimes, or the MTU of an interface changed, so results derived
+ * from them can be cached as long as it stays the same.
+ */
+extern volatile unsigned gnrc_ipv6_netif_generation;
+
 /**
  * @brief Initializes the module.
  */
 void gnrc_ipv6_netif_init(void);
 
+/**
+ * @brief   Marks the IPv6 interfaces as changed
+ *
+ * Must be called after an address, its flags or lifetimes, or the MTU of an
+ * interface were changed directly.
+ */
+static inline void gnrc_ipv6_netif_changed(void)
+{
+    gnrc_ipv6_netif_generation++;
+}
+
 /**
  * @brief   Add interface to IPv6.
  *
@@ -516,6 +536,11 @@ ipv6_addr_t *gnrc_ipv6_netif_match_prefix(kernel_pid_t pid, const ipv6_addr_t *p
  * @brief   Searches for the best address on an interface usable as a
  *          source address for a given destination address.
  *
+ * The rules that only depend on the scope of @p dest are evaluated once per
+ * class of destination scopes when the addresses of the interface changed
+ * (see @ref gnrc_ipv6_netif_generation), so a lookup only compares the
+ * prefixes of the remaining addresses.
+ *
  * @param[in] pid     The PID to the interface.
  * @param[in] dest    The destination address you want to find a destination
  *                    address for.
@@ -62,6 +62,7 @@
 #include "net/netopt.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
+#include "net/gnrc/netreg.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -92,6 +93,31 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a batch of received
+ *          @ref net_gnrc_pkt "packets" up the network stack
+ *
+ * The message carries a batch snip as created by
+ * @ref gnrc_netapi_dispatch_receive_batch(). The receiver handles every
+ * packet in the batch as if it was received with a
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV message and releases the batch snip
+ * afterwards. Use @ref gnrc_netapi_batch_numof() and
+ * @ref gnrc_netapi_batch_get() to access the packets.
+ *
+ * @note    Only sent to registry entries marked with
+ *          @ref gnrc_netapi_batch_accept(). All other subscribers get the
+ *          packets of a batch one by one as @ref GNRC_NETAPI_MSG_TYPE_RCV
+ *          messages.
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BATCH  (0x0206)
+
+/**
+ * @brief   Maximum number of packets in a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+ */
+#ifndef GNRC_NETAPI_BATCH_SIZE
+#define GNRC_NETAPI_BATCH_SIZE          (8U)
+#endif
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -170,6 +196,72 @@ static inline int gnrc_netapi_dispatch_receive(gnrc_nettype_t type, uint32_t dem
     return gnrc_netapi_dispatch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
 }
 
+/**
+ * @brief   Sends the packets in @p pkts as one
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH command to all subscribers to
+ *          (@p type, @p demux_ctx).
+ *
+ * All packets are delivered with a single message to every thread subscriber
+ * marked with @ref gnrc_netapi_batch_accept(), so the receiving thread is only
+ * woken up once for the whole batch. All other subscribers, including those
+ * of type @ref GNRC_NETREG_TYPE_MBOX and @ref GNRC_NETREG_TYPE_CB, get every
+ * packet separately as @ref GNRC_NETAPI_MSG_TYPE_RCV command. If @p numof is 1 or the batch snip
+ * can not be allocated, the packets are dispatched separately as well.
+ *
+ * @pre `0 < numof <= GNRC_NETAPI_BATCH_SIZE`
+ *
+ * @param[in] type      type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] pkts      packets to dispatch. The packets are released by this
+ *                      function if there are no subscribers.
+ * @param[in] numof     number of packets in @p pkts
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t **pkts, unsigned numof);
+
+/**
+ * @brief   Lets the thread of a registry entry receive
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages
+ *
+ * Call this after registering @p entry with @ref gnrc_netreg_register(), if
+ * its thread handles batches. The mark is bound to the registration, not to
+ * the thread, so it goes away with the entry.
+ *
+ * @pre @p entry is of type @ref GNRC_NETREG_TYPE_DEFAULT
+ *
+ * @param[in] entry     a registered entry of a thread handling batches
+ */
+void gnrc_netapi_batch_accept(gnrc_netreg_entry_t *entry);
+
+/**
+ * @brief   Gets the number of packets in a batch snip
+ *
+ * @param[in] batch     content of a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message
+ *
+ * @return  number of packets in @p batch
+ */
+static inline unsigned gnrc_netapi_batch_numof(const gnrc_pktsnip_t *batch)
+{
+    return batch->size / sizeof(gnrc_pktsnip_t *);
+}
+
+/**
+ * @brief   Gets a packet from a batch snip
+ *
+ * @param[in] batch     content of a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message
+ * @param[in] idx       index of the packet. Must be lesser than
+ *                      gnrc_netapi_batch_numof(@p batch)
+ *
+ * @return  the packet at @p idx
+ */
+static inline gnrc_pktsnip_t *gnrc_netapi_batch_get(const gnrc_pktsnip_t *batch,
+                                                    unsigned idx)
+{
+    return ((gnrc_pktsnip_t **)batch->data)[idx];
+}
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET messages and
  *          parsing the returned @ref GNRC_NETAPI_MSG_TYPE_ACK message
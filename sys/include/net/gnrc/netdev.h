@@ -55,6 +55,16 @@ extern "C" {
  */
 #define NETDEV_MSG_TYPE_EVENT 0x1234
 
+/**
+ * @brief   Thread flag the device's interrupt sets for the gnrc_netdev thread
+ *
+ * The thread waits for it and for netapi messages with
+ * thread_flags_msg_wait_any().
+ */
+#ifndef GNRC_NETDEV_THREAD_FLAG_EVENT
+#define GNRC_NETDEV_THREAD_FLAG_EVENT   (0x0001)
+#endif
+
 /**
  * @brief   Mask for @ref gnrc_mac_tx_feedback_t
  */
@@ -102,6 +112,18 @@ typedef struct gnrc_netdev {
      */
     kernel_pid_t pid;
 
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief received packets not yet passed up the network stack
+     */
+    gnrc_pktsnip_t *rx_batch[GNRC_NETAPI_BATCH_SIZE];
+
+    /**
+     * @brief number of packets in gnrc_netdev_t::rx_batch
+     */
+    uint8_t rx_batch_numof;
+#endif
+
 #ifdef MODULE_GNRC_MAC
     /**
      * @brief general information for the MAC protocol
@@ -22,6 +22,7 @@
 #define NETREG_H
 
 #include <inttypes.h>
+#include <stdbool.h>
 
 #include "kernel_types.h"
 #include "net/gnrc/nettype.h"
@@ -60,6 +61,35 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @brief   Number of hash buckets per @ref gnrc_nettype_t in the registry
+ *
+ * With 0 there is a single list of entries per type, as before the buckets
+ * were introduced. Otherwise entries are sorted into the buckets by their
+ * @ref gnrc_netreg_entry_t::demux_ctx, so lookups only need to walk the
+ * entries of one bucket. Entries with @ref GNRC_NETREG_DEMUX_CTX_ALL are kept
+ * in an additional bucket of their own. Every bucket costs one pointer per
+ * type, so only builds with a lot of registrations per type (e.g. many UDP
+ * ports) should set this.
+ *
+ * @note    Should be a power of 2, e.g. 8.
+ */
+#ifndef GNRC_NETREG_BUCKETS
+#define GNRC_NETREG_BUCKETS         (0U)
+#endif
+
+/**
+ * @brief   Initial value of @ref gnrc_netreg_entry_t::batch in the static
+ *          initializers below
+ *
+ * @internal
+ */
+#ifdef MODULE_GNRC_NETAPI_BATCH
+#define GNRC_NETREG_ENTRY_INIT_BATCH    false
+#else
+#define GNRC_NETREG_ENTRY_INIT_BATCH
+#endif
+
 /**
  * @brief   Initializes a netreg entry statically with PID
  *
@@ -72,9 +102,11 @@ typedef enum {
 #ifdef MODULE_GNRC_NETAPI_MBOX
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
-                                                      { pid } }
+                                                      { pid }, \
+                                                      GNRC_NETREG_ENTRY_INIT_BATCH }
 #else
-#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
+#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid }, \
+                                                      GNRC_NETREG_ENTRY_INIT_BATCH }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -91,7 +123,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_MBOX(demux_ctx, mbox) { NULL, demux_ctx, \
                                                        GNRC_NETREG_TYPE_MBOX, \
-                                                       { .mbox = mbox } }
+                                                       { .mbox = mbox }, \
+                                                       GNRC_NETREG_ENTRY_INIT_BATCH }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
@@ -108,7 +141,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, cbd)   { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_CB, \
-                                                      { .cbd = cbd } }
+                                                      { .cbd = cbd }, \
+                                                      GNRC_NETREG_ENTRY_INIT_BATCH }
 
 /**
  * @brief   Packet handler callback for netreg entries with callback.
@@ -185,6 +219,19 @@ typedef struct gnrc_netreg_entry {
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
     } target;                   /**< Target for the registry entry */
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   The target thread handles @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+     *
+     * @details Cleared by @ref gnrc_netreg_register(), set by
+     *          @ref gnrc_netapi_batch_accept().
+     *
+     * @note    Only available with `gnrc_netapi_batch`.
+     *
+     * @internal
+     */
+    bool batch;
+#endif
 } gnrc_netreg_entry_t;
 
 /**
@@ -25,6 +25,7 @@
 #include <inttypes.h>
 #include <stdlib.h>
 
+#include "atomic_compat.h"
 #include "kernel_types.h"
 #include "net/gnrc/nettype.h"
 
@@ -104,9 +105,13 @@ typedef struct gnrc_pktsnip {
     /**
      * @brief   Counter of threads currently having control over this packet.
      *
+     * @details Only changed with atomic operations, so the packet buffer
+     *          does not need to take its lock for gnrc_pktbuf_hold() and
+     *          gnrc_pktbuf_release().
+     *
      * @internal
      */
-    unsigned int users;
+    atomic_uint users;
     struct gnrc_pktsnip *next;      /**< next snip in the packet */
     void *data;                     /**< pointer to the data of the snip */
     size_t size;                    /**< the length of the snip in byte */
@@ -115,6 +120,10 @@ typedef struct gnrc_pktsnip {
     kernel_pid_t err_sub;           /**< subscriber to errors related to this
                                      *   packet snip */
 #endif
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+    kernel_pid_t owner;             /**< thread that allocated the snip
+                                     *   descriptor @internal */
+#endif
 } gnrc_pktsnip_t;
 
 /**
@@ -58,8 +58,87 @@ extern "C" {
 #define GNRC_PKTBUF_SIZE    (6144)
 #endif  /* GNRC_PKTBUF_SIZE */
 
+/**
+ * @brief   Number of free snip descriptors every thread keeps for itself
+ *
+ * @details Only used with the `gnrc_pktbuf_static_cache` module. Packet snip
+ *          descriptors released by a thread are kept in a small per-thread
+ *          cache and handed out again to the same thread without walking the
+ *          packet buffer and without taking its lock. This absorbs the
+ *          alloc/free churn of headers being added and removed by a thread.
+ *          Only descriptors the thread allocated itself go to its cache,
+ *          those released by other threads are returned to the packet
+ *          buffer. When the packet buffer runs out of space, the caches of
+ *          all threads are returned to it, including those of threads that
+ *          exited.
+ */
+#ifndef GNRC_PKTBUF_STATIC_CACHE_SIZE
+#define GNRC_PKTBUF_STATIC_CACHE_SIZE   (2U)
+#endif
+
+/**
+ * @name    Slab configuration for the `gnrc_pktbuf_slab` backend
+ *
+ * The `gnrc_pktbuf_slab` module replaces the first-fit arena of
+ * `gnrc_pktbuf_static` by fixed-size slabs: one for the packet snip
+ * descriptors and one per common payload size class. Allocation and release
+ * are O(1) and the buffer does not fragment externally. A request is served
+ * from the smallest size class with a free block. If no such class has a free
+ * block, the request fails.
+ *
+ * The default configuration needs roughly the same amount of RAM as
+ * @ref GNRC_PKTBUF_SIZE.
+ * @{
+ */
+/**
+ * @brief   Number of packet snip descriptors
+ */
+#ifndef GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define GNRC_PKTBUF_SLAB_SNIP_NUMOF         (32U)
+#endif
+
+/**
+ * @brief   Block size of the size class for small payloads (e.g. headers)
+ */
+#ifndef GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define GNRC_PKTBUF_SLAB_SMALL_SIZE         (64U)
+#endif
+
+/**
+ * @brief   Number of blocks of size @ref GNRC_PKTBUF_SLAB_SMALL_SIZE
+ */
+#ifndef GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define GNRC_PKTBUF_SLAB_SMALL_NUMOF        (16U)
+#endif
+
+/**
+ * @brief   Number of blocks that fit an IEEE 802.15.4 frame
+ */
+#ifndef GNRC_PKTBUF_SLAB_IEEE802154_NUMOF
+#define GNRC_PKTBUF_SLAB_IEEE802154_NUMOF   (8U)
+#endif
+
+/**
+ * @brief   Number of blocks that fit an IPv6 packet of minimum MTU size
+ */
+#ifndef GNRC_PKTBUF_SLAB_IPV6_NUMOF
+#define GNRC_PKTBUF_SLAB_IPV6_NUMOF         (2U)
+#endif
+
+/**
+ * @brief   Number of blocks that fit an Ethernet frame
+ */
+#ifndef GNRC_PKTBUF_SLAB_ETHERNET_NUMOF
+#define GNRC_PKTBUF_SLAB_ETHERNET_NUMOF     (1U)
+#endif
+/** @} */
+
 /**
  * @brief   Initializes packet buffer module.
+ *
+ * @note    gnrc_pktsnip_t::users is only ever changed atomically, so
+ *          gnrc_pktbuf_hold() and gnrc_pktbuf_release() only take the packet
+ *          buffer's lock when a snip actually needs to be freed.
  */
 void gnrc_pktbuf_init(void);
 
@@ -87,6 +166,28 @@ void gnrc_pktbuf_init(void);
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, void *data, size_t size,
                                 gnrc_nettype_t type);
 
+/**
+ * @brief   Allocates a packet snip a network device can receive a frame into,
+ *          so the frame's link layer header can later be split off with
+ *          gnrc_pktbuf_mark() without moving any data.
+ *
+ * The data of the snip is placed in the packet buffer so that the data
+ * following the first @p hdr_len bytes starts at an aligned address. After
+ * the device driver wrote the frame into gnrc_pktsnip_t::data of the result,
+ * `gnrc_pktbuf_mark(result, hdr_len, type)` and every subsequent mark of
+ * headers with aligned lengths (e.g. the IPv6 header) are views into the
+ * same buffer. The frame is therefore only copied once: from the device into
+ * the packet buffer.
+ *
+ * @param[in] size      Maximum length of the frame to receive.
+ * @param[in] hdr_len   Length of the link layer header of the frame.
+ *
+ * @return  Pointer to a packet snip of type @ref GNRC_NETTYPE_UNDEF with
+ *          @p size bytes of uninitialized data.
+ * @return  NULL, if no space is left in the packet buffer.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_add_rx(size_t size, size_t hdr_len);
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
@@ -281,7 +382,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t t
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes. With
+ *          `gnrc_pktbuf_slab` the current and maximum occupancy of every
+ *          slab is printed instead.
  */
 void gnrc_pktbuf_stats(void);
 #endif
@@ -291,6 +394,10 @@ void gnrc_pktbuf_stats(void);
 /**
  * @brief   Checks if packet buffer is empty
  *
+ * @note    With `gnrc_pktbuf_static_cache` this returns all cached snip
+ *          descriptors to the packet buffer first, so only call it when no
+ *          other thread is using the packet buffer.
+ *
  * @return  true, if packet buffer is empty
  * @return  false, if packet buffer is not empty
  */
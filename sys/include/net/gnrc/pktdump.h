@@ -51,6 +51,10 @@ extern "C" {
 
 /**
  * @brief   The PID of the pktdump thread
+ *
+ * @note    The pktdump thread handles @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH, so
+ *          registry entries for it may be marked with
+ *          @ref gnrc_netapi_batch_accept().
  */
 extern kernel_pid_t gnrc_pktdump_pid;
 
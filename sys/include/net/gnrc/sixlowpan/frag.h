@@ -42,6 +42,25 @@ extern "C" {
  */
 #define GNRC_SIXLOWPAN_MSG_FRAG_SND    (0x0225)
 
+/**
+ * @brief   Message type for removing timed out datagrams from the reassembly
+ *          buffer
+ */
+#define GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF (0x0226)
+
+/**
+ * @brief   Number of datagrams that can be reassembled at the same time
+ *
+ * Every datagram takes an entry of about 64 byte, in addition to its space
+ * in the packet buffer. If the reassembly buffer is full, the datagram that
+ * received a fragment least recently is dropped for a new one.
+ *
+ * @note    At most 255
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_RBUF_SIZE
+#define GNRC_SIXLOWPAN_FRAG_RBUF_SIZE  (4U)
+#endif
+
 /**
  * @brief   Definition of 6LoWPAN fragmentation type.
  */
@@ -68,6 +87,14 @@ void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg);
  */
 void gnrc_sixlowpan_frag_handle_pkt(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Removes timed out datagrams from the reassembly buffer
+ *
+ * Must be called by the thread that handles the fragments on
+ * @ref GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF.
+ */
+void gnrc_sixlowpan_frag_gc_rbuf(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,6 +11,11 @@
  * @ingroup     net_gnrc
  * @brief       GNRC's implementation of the UDP protocol
  *
+ * With the @ref sys_event_thread "event_thread" module, UDP does not start a
+ * thread of its own but processes its packets on the shared event thread.
+ * @ref GNRC_UDP_MSG_QUEUE_SIZE then sets the number of packets that can be
+ * queued for it.
+ *
  * @{
  *
  * @file
@@ -73,6 +73,53 @@ static inline uint16_t inet_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
     return inet_csum_slice(sum, buf, len, 0);
 }
 
+/**
+ * @brief   Updates an Internet Checksum after a part of its domain changed
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1624">
+ *          RFC 1624
+ *      </a>
+ *
+ * @details This avoids recalculating the checksum over the full domain, e.g.
+ *          when a header field is rewritten. Unlike inet_csum(), @p csum and
+ *          the result are normalized, i.e. the value as it is found in the
+ *          header, in host byte order. A result of 0x0000 is not mapped to
+ *          0xffff, this is up to the caller (e.g. for UDP).
+ *
+ * @param[in] csum      The normalized checksum before the change.
+ * @param[in] old       The old contents of the changed part.
+ * @param[in] new       The new contents of the changed part.
+ * @param[in] len       Length of @p old and @p new in byte. The changed part
+ *                      must start at an even offset in the checksum domain.
+ *
+ * @return  The normalized checksum after the change.
+ */
+uint16_t inet_csum_update(uint16_t csum, const uint8_t *old, const uint8_t *new,
+                          uint16_t len);
+
+/**
+ * @brief   Updates an Internet Checksum after a 16-bit word of its domain
+ *          changed
+ *
+ * @see inet_csum_update()
+ *
+ * @param[in] csum      The normalized checksum before the change.
+ * @param[in] old       The old value of the word in host byte order.
+ * @param[in] new       The new value of the word in host byte order.
+ *
+ * @return  The normalized checksum after the change.
+ */
+static inline uint16_t inet_csum_update16(uint16_t csum, uint16_t old,
+                                          uint16_t new)
+{
+    /* RFC 1624, eqn. 3: HC' = ~(~HC + ~m + m') */
+    uint32_t sum = (uint16_t)~csum + (uint16_t)~old + (uint32_t)new;
+
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return ~sum;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_edf Earliest deadline first scheduling
+ * @ingroup     sys
+ * @brief       Periodic threads scheduled by their deadlines
+ *
+ * With the `sched_edf` module, threads can switch to an earliest deadline
+ * first (EDF) scheduling class. An EDF thread declares its period, its
+ * relative deadline and the worst-case execution time (WCET) of one job,
+ * i.e. of one loop iteration. After every job, it calls sched_edf_wait(),
+ * which sleeps until the next period starts.
+ *
+ * All EDF threads share the priority level @ref SCHED_EDF_PRIORITY, whose
+ * run queue is kept sorted by the absolute deadline of the current job, so
+ * the scheduler picks the earliest deadline in O(1) before falling back to
+ * the fixed priority run queues below. Queueing an EDF thread is O(number of
+ * ready EDF threads).
+ *
+ * sched_edf_enter() only admits a thread if the total density
+ * (sum of WCET / deadline) of all EDF threads stays below
+ * @ref SCHED_EDF_UTIL_MAX. Under this condition, EDF meets all deadlines,
+ * as long as the threads stay within their WCET and nothing with a higher
+ * priority (interrupts, threads above @ref SCHED_EDF_PRIORITY) takes the
+ * CPU for too long. Jobs that still finish after their deadline are counted
+ * in sched_edf_t::misses.
+ *
+ * Times are in microseconds, periods must be shorter than 2^31 us.
+ *
+ * @note    Only the thread itself may call the functions on its
+ *          @ref sched_edf_t. Blocking on a mutex or a message inside of a
+ *          job is allowed, the time spent blocked counts against the
+ *          deadline.
+ *
+ * @{
+ *
+ * @file
+ * @brief       EDF scheduling API
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef SCHED_EDF_H
+#define SCHED_EDF_H
+
+#include <stdint.h>
+
+#include "sched.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum total density of all EDF threads in percent
+ *
+ * Lower this to leave CPU time for interrupts and for threads with a fixed
+ * priority.
+ */
+#ifndef SCHED_EDF_UTIL_MAX
+#define SCHED_EDF_UTIL_MAX  (100U)
+#endif
+
+/**
+ * @brief   EDF state of a thread
+ */
+typedef struct {
+    thread_t *thread;           /**< the EDF thread */
+    uint32_t period;            /**< period in us */
+    uint32_t deadline;          /**< deadline relative to the release in us */
+    uint32_t release;           /**< release time of the current job */
+    uint32_t util;              /**< admitted density, 1/65536 */
+    uint8_t priority;           /**< priority before sched_edf_enter() */
+    unsigned jobs;              /**< number of finished jobs */
+    unsigned misses;            /**< number of jobs that finished after
+                                 *   their deadline */
+    xtimer_t timer;             /**< wakes up the thread for the next job */
+} sched_edf_t;
+
+/**
+ * @brief   Make the calling thread an EDF thread
+ *
+ * The first job is released immediately.
+ *
+ * @param[out] edf      EDF state of the thread
+ * @param[in]  period   period in us
+ * @param[in]  deadline deadline relative to the start of a period in us,
+ *                      0 < @p deadline <= @p period
+ * @param[in]  wcet     worst-case execution time of a job in us,
+ *                      0 < @p wcet <= @p deadline
+ *
+ * @return  0 on success
+ * @return  -EINVAL on invalid parameters
+ * @return  -EBUSY if admitting the thread would exceed
+ *          @ref SCHED_EDF_UTIL_MAX
+ */
+int sched_edf_enter(sched_edf_t *edf, uint32_t period, uint32_t deadline,
+                    uint32_t wcet);
+
+/**
+ * @brief   Finish the current job and sleep until the next period
+ *
+ * If the next period already started, the next job is released
+ * immediately.
+ *
+ * @param[in,out] edf   EDF state of the calling thread
+ */
+void sched_edf_wait(sched_edf_t *edf);
+
+/**
+ * @brief   Leave the EDF class
+ *
+ * The thread gets back the priority it had before sched_edf_enter() and
+ * its density is freed for other EDF threads. With
+ * `core_mutex_priority_inheritance`, a higher priority inherited from
+ * threads waiting for its mutexes is kept until it unlocks them.
+ *
+ * @param[in,out] edf   EDF state of the calling thread
+ */
+void sched_edf_leave(sched_edf_t *edf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_EDF_H */
+/** @} */
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_schedtrace Scheduler trace
+ * @ingroup     sys
+ * @brief       Records scheduler and IPC events into a ring buffer
+ *
+ * With the `schedtrace` module, the kernel records context switches, message
+ * sends and receives, and threads blocking on and being woken up from a
+ * mutex. Every event is an 8 byte record with a timestamp in xtimer ticks.
+ * Events are written into a fixed-size ring buffer, so the buffer always
+ * holds the most recent @ref SCHEDTRACE_SIZE events. Recording an event only
+ * takes a timer read and an 8 byte store with interrupts disabled, so the
+ * trace can stay enabled in production builds.
+ *
+ * Mutexes are identified by the lower 16 bits of their address. These are
+ * unique as long as all mutexes are in the same 64 KiB of RAM; on devices
+ * with more RAM, two mutexes may show up with the same identifier.
+ *
+ * The trace can be exported with schedtrace_export() in the format described
+ * below, dumped as hex over the shell (`schedtrace dump`), or written to a
+ * file with schedtrace_save(). `dist/tools/schedtrace/schedtrace2json.py`
+ * converts the export into a Chrome trace that can be opened in
+ * chrome://tracing or Perfetto.
+ *
+ * Export format (all fields in the byte order of the device):
+ *
+ *     schedtrace_hdr_t
+ *     schedtrace_hdr_t::threads times:
+ *         uint8_t pid, uint8_t len, char name[len]
+ *     schedtrace_hdr_t::numof times:
+ *         schedtrace_event_t, oldest first
+ *
+ * @{
+ *
+ * @file
+ * @brief       Scheduler trace definitions
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef SCHEDTRACE_H
+#define SCHEDTRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "kernel_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of events kept in the ring buffer
+ *
+ * @note    Must be a power of two
+ */
+#ifndef SCHEDTRACE_SIZE
+#define SCHEDTRACE_SIZE     (128U)
+#endif
+
+/**
+ * @brief   Magic number at the start of an export, "RTRC" in little endian
+ */
+#define SCHEDTRACE_MAGIC    (0x43525452UL)
+
+/**
+ * @brief   Version of the export format
+ */
+#define SCHEDTRACE_VERSION  (1U)
+
+/**
+ * @brief   Event types
+ */
+typedef enum {
+    SCHEDTRACE_SWITCH = 1,      /**< thread `pid` starts running, `arg` is
+                                 *   the previous thread */
+    SCHEDTRACE_MSG_SEND,        /**< thread `pid` hands a message (or a
+                                 *   reply) over to `arg`, messages that are
+                                 *   not sent are not recorded */
+    SCHEDTRACE_MSG_RECEIVE,     /**< thread `pid` received a message (or a
+                                 *   reply) from `arg` */
+    SCHEDTRACE_MUTEX_BLOCK,     /**< thread `pid` blocks on the mutex at
+                                 *   (the lower 16 bits of) address `arg` */
+    SCHEDTRACE_MUTEX_UNBLOCK,   /**< thread `pid` is woken up by unlocking
+                                 *   the mutex at (the lower 16 bits of)
+                                 *   address `arg` */
+} schedtrace_type_t;
+
+/**
+ * @brief   A recorded event
+ */
+typedef struct {
+    uint32_t time;              /**< xtimer ticks (32 bit) */
+    uint8_t type;               /**< @ref schedtrace_type_t */
+    uint8_t pid;                /**< thread the event is about */
+    uint16_t arg;               /**< event specific argument */
+} schedtrace_event_t;
+
+/**
+ * @brief   Header of an export
+ */
+typedef struct {
+    uint32_t magic;             /**< @ref SCHEDTRACE_MAGIC */
+    uint8_t version;            /**< @ref SCHEDTRACE_VERSION */
+    uint8_t event_size;         /**< sizeof(schedtrace_event_t) */
+    uint16_t numof;             /**< number of events */
+    uint32_t hz;                /**< frequency of the timestamps */
+    uint8_t threads;            /**< number of thread name entries */
+    uint8_t isr_pid;            /**< pid used for events in interrupt
+                                 *   context, KERNEL_PID_ISR */
+    uint8_t reserved[2];        /**< always 0 */
+} schedtrace_hdr_t;
+
+/**
+ * @brief   Callback to write a chunk of an export
+ *
+ * @param[in] data  the data to write
+ * @param[in] len   the length of @p data
+ * @param[in] arg   argument passed to schedtrace_export()
+ *
+ * @return  0 on success
+ * @return  < 0 on error, this stops the export
+ */
+typedef int (*schedtrace_write_t)(const void *data, size_t len, void *arg);
+
+/**
+ * @brief   Record an event
+ *
+ * Can be called from interrupt context.
+ *
+ * @param[in] type  type of the event
+ * @param[in] pid   thread the event is about
+ * @param[in] arg   event specific argument
+ */
+void schedtrace_add(schedtrace_type_t type, kernel_pid_t pid, uint16_t arg);
+
+/**
+ * @brief   Start or stop recording events
+ *
+ * Recording is enabled on start-up.
+ *
+ * @param[in] enable    true to record events
+ */
+void schedtrace_enable(bool enable);
+
+/**
+ * @brief   Drop all recorded events
+ */
+void schedtrace_clear(void);
+
+/**
+ * @brief   Get the number of events in the ring buffer
+ *
+ * @return  number of events, at most @ref SCHEDTRACE_SIZE
+ */
+unsigned schedtrace_numof(void);
+
+/**
+ * @brief   Export the recorded events
+ *
+ * Recording is paused during the export, so all exported events are
+ * complete and events recorded meanwhile are dropped.
+ *
+ * @param[in] write     called for every chunk of the export
+ * @param[in] arg       passed to @p write
+ *
+ * @return  number of exported events
+ * @return  error returned by @p write
+ */
+int schedtrace_export(schedtrace_write_t write, void *arg);
+
+#if defined(MODULE_VFS) || defined(DOXYGEN)
+/**
+ * @brief   Export the recorded events into a file
+ *
+ * @note    Only available with the `vfs` module.
+ *
+ * @param[in] path  the file to write, it is created or truncated
+ *
+ * @return  number of exported events
+ * @return  < 0 on error
+ */
+int schedtrace_save(const char *path);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDTRACE_H */
+/** @} */
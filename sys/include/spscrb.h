@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_spscrb Single-producer single-consumer ringbuffer
+ * @ingroup     sys
+ * @brief       Lock-free ringbuffer for one writer and one reader
+ *
+ * Like @ref sys_tsrb, this ringbuffer needs no locking if there is exactly
+ * one producer (e.g., an ISR) and one consumer (e.g., a thread). The read and
+ * write counters are C11 atomics: the producer publishes data with a release
+ * store of the write counter after copying it in, the consumer frees space
+ * with a release store of the read counter after copying it out, so this is
+ * also correct on CPUs that reorder memory accesses.
+ *
+ * Data is copied with `memcpy()` in at most two contiguous chunks (before and
+ * after the wrap-around) instead of byte by byte. For zero-copy access,
+ * spscrb_peek_span() and spscrb_consume() give the reader direct access to
+ * the buffered data, and spscrb_reserve_span() and spscrb_commit() let the
+ * writer fill the buffer in place.
+ *
+ * @note    The buffer size must be a power of two.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Single-producer single-consumer ringbuffer interface
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef SPSCRB_H
+#define SPSCRB_H
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "atomic_compat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Ringbuffer structure
+ */
+typedef struct {
+    uint8_t *buf;               /**< buffer to operate on */
+    unsigned size;              /**< size of buf, a power of two */
+    atomic_uint reads;          /**< total number of bytes read, only
+                                 *   changed by the consumer */
+    atomic_uint writes;         /**< total number of bytes written, only
+                                 *   changed by the producer */
+} spscrb_t;
+
+/**
+ * @brief   Static initializer
+ *
+ * @param[in] BUF   array to use as buffer, its size must be a power of two
+ */
+#define SPSCRB_INIT(BUF) { (uint8_t *)(BUF), sizeof(BUF), \
+                           ATOMIC_VAR_INIT(0), ATOMIC_VAR_INIT(0) }
+
+/**
+ * @brief   Initialize a ringbuffer
+ *
+ * @param[out] rb       ringbuffer to initialize
+ * @param[in]  buf      buffer to use
+ * @param[in]  size     size of @p buf, must be a power of two
+ */
+static inline void spscrb_init(spscrb_t *rb, void *buf, unsigned size)
+{
+    assert((size != 0) && ((size & (size - 1)) == 0));
+
+    rb->buf = (uint8_t *)buf;
+    rb->size = size;
+    atomic_init(&rb->reads, 0);
+    atomic_init(&rb->writes, 0);
+}
+
+/**
+ * @brief   Get the number of bytes available for reading
+ *
+ * Exact when called by the consumer, a lower bound otherwise.
+ *
+ * @param[in] rb    ringbuffer to operate on
+ *
+ * @return  number of buffered bytes
+ */
+static inline unsigned spscrb_avail(spscrb_t *rb)
+{
+    return atomic_load_explicit(&rb->writes, memory_order_acquire) -
+           atomic_load_explicit(&rb->reads, memory_order_relaxed);
+}
+
+/**
+ * @brief   Get the free space of the ringbuffer
+ *
+ * Exact when called by the producer, a lower bound otherwise.
+ *
+ * @param[in] rb    ringbuffer to operate on
+ *
+ * @return  number of bytes that can be written
+ */
+static inline unsigned spscrb_free(spscrb_t *rb)
+{
+    return rb->size - (atomic_load_explicit(&rb->writes, memory_order_relaxed) -
+                       atomic_load_explicit(&rb->reads, memory_order_acquire));
+}
+
+/**
+ * @brief   Test if the ringbuffer is empty
+ *
+ * @param[in] rb    ringbuffer to operate on
+ *
+ * @return  1 if empty, 0 otherwise
+ */
+static inline int spscrb_empty(spscrb_t *rb)
+{
+    return spscrb_avail(rb) == 0;
+}
+
+/**
+ * @brief   Test if the ringbuffer is full
+ *
+ * @param[in] rb    ringbuffer to operate on
+ *
+ * @return  1 if full, 0 otherwise
+ */
+static inline int spscrb_full(spscrb_t *rb)
+{
+    return spscrb_free(rb) == 0;
+}
+
+/**
+ * @brief   Add a byte (producer)
+ *
+ * @param[in] rb    ringbuffer to operate on
+ * @param[in] c     byte to add
+ *
+ * @return  0 on success
+ * @return  -1 if the ringbuffer is full
+ */
+int spscrb_add_one(spscrb_t *rb, uint8_t c);
+
+/**
+ * @brief   Add bytes (producer)
+ *
+ * @param[in] rb    ringbuffer to operate on
+ * @param[in] src   data to add
+ * @param[in] n     number of bytes in @p src
+ *
+ * @return  number of bytes added, less than @p n if the ringbuffer got full
+ */
+size_t spscrb_add(spscrb_t *rb, const void *src, size_t n);
+
+/**
+ * @brief   Get a byte (consumer)
+ *
+ * @param[in] rb    ringbuffer to operate on
+ *
+ * @return  the byte
+ * @return  -1 if the ringbuffer is empty
+ */
+int spscrb_get_one(spscrb_t *rb);
+
+/**
+ * @brief   Get bytes (consumer)
+ *
+ * @param[in]  rb   ringbuffer to operate on
+ * @param[out] dst  buffer to copy to
+ * @param[in]  n    size of @p dst
+ *
+ * @return  number of bytes copied to @p dst
+ */
+size_t spscrb_get(spscrb_t *rb, void *dst, size_t n);
+
+/**
+ * @brief   Get the contiguous readable part of the buffered data (consumer)
+ *
+ * The data stays in the ringbuffer until it is released with
+ * spscrb_consume(). If the buffered data wraps around the end of the buffer,
+ * only the part up to the end is returned, call this function again after
+ * consuming it to get the rest.
+ *
+ * @param[in]  rb   ringbuffer to operate on
+ * @param[out] span start of the data
+ *
+ * @return  number of bytes at @p span, 0 if the ringbuffer is empty
+ */
+size_t spscrb_peek_span(spscrb_t *rb, const uint8_t **span);
+
+/**
+ * @brief   Remove bytes returned by spscrb_peek_span() (consumer)
+ *
+ * @param[in] rb    ringbuffer to operate on
+ * @param[in] n     number of bytes to remove, at most the length returned
+ *                  by spscrb_peek_span()
+ */
+void spscrb_consume(spscrb_t *rb, size_t n);
+
+/**
+ * @brief   Get the contiguous writable part of the free space (producer)
+ *
+ * Data written to @p span is added with spscrb_commit(). If the free space
+ * wraps around the end of the buffer, only the part up to the end is
+ * returned.
+ *
+ * @param[in]  rb   ringbuffer to operate on
+ * @param[out] span start of the free space
+ *
+ * @return  number of bytes that can be written to @p span, 0 if the
+ *          ringbuffer is full
+ */
+size_t spscrb_reserve_span(spscrb_t *rb, uint8_t **span);
+
+/**
+ * @brief   Add bytes written to the span of spscrb_reserve_span() (producer)
+ *
+ * @param[in] rb    ringbuffer to operate on
+ * @param[in] n     number of bytes written, at most the length returned by
+ *                  spscrb_reserve_span()
+ */
+void spscrb_commit(spscrb_t *rb, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPSCRB_H */
+/** @} */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_threadstat Thread statistics
+ * @ingroup     sys
+ * @brief       Background sampling of per-thread CPU load and stack usage
+ *
+ * The `threadstat` module samples the runtime counters of
+ * `schedstatistics` every @ref THREADSTAT_INTERVAL from a timer callback and
+ * keeps three values of the CPU load of every thread: the load of the last
+ * interval, and two exponential moving averages that add 1/10 and 1/60 of
+ * the difference to every new sample. Like the load average of Unix, these
+ * follow the load with time constants of about 10 and 60 intervals (10s
+ * and 60s with the default interval), but a single busy interval still
+ * shows up in them.
+ *
+ * With `DEVELHELP`, the stack high-water mark of every thread is updated at
+ * the same time. Instead of scanning the whole stack for the canary pattern
+ * like `ps` does, only the words below the previous high-water mark are
+ * checked, so a sample costs O(stack growth). The scan stops after
+ * @ref THREADSTAT_STACK_GAP untouched words in a row; a larger untouched
+ * area (e.g. an unused buffer on the stack) may hide usage below it.
+ * Threads must be created with @ref THREAD_CREATE_STACKTEST for this to work.
+ *
+ * Reading the statistics with threadstat_get() or threadstat_cpu() is O(1).
+ * With `saul_default`, the total CPU load is also registered as a SAUL
+ * sensor of class @ref SAUL_SENSE_CPU, so it can be queried like any other
+ * sensor, e.g. through a CoAP resource. The load of single threads is not
+ * exported through SAUL, as threads come and go while SAUL entries are
+ * static; use threadstat_get() for it.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Thread statistics API
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef THREADSTAT_H
+#define THREADSTAT_H
+
+#include <stdint.h>
+
+#include "kernel_types.h"
+#include "saul.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Sampling interval in microseconds
+ */
+#ifndef THREADSTAT_INTERVAL
+#define THREADSTAT_INTERVAL     (1000000U)
+#endif
+
+/**
+ * @brief   Number of untouched stack words that end a high-water mark scan
+ */
+#ifndef THREADSTAT_STACK_GAP
+#define THREADSTAT_STACK_GAP    (8U)
+#endif
+
+/**
+ * @brief   Kinds of CPU load values
+ */
+enum {
+    THREADSTAT_LOAD_1,          /**< last interval */
+    THREADSTAT_LOAD_10,         /**< moving average with a weight of 1/10 */
+    THREADSTAT_LOAD_60,         /**< moving average with a weight of 1/60 */
+    THREADSTAT_LOAD_NUMOF,      /**< number of load values */
+};
+
+/**
+ * @brief   Statistics of a thread
+ */
+typedef struct {
+    uint16_t load[THREADSTAT_LOAD_NUMOF];   /**< CPU load in 1/100 percent */
+    uint16_t stack_size;        /**< stack size in bytes, 0 without
+                                 *   `DEVELHELP` */
+    uint16_t stack_used;        /**< stack high-water mark in bytes, 0
+                                 *   without `DEVELHELP` */
+} threadstat_t;
+
+/**
+ * @brief   SAUL driver for the total CPU load
+ *
+ * Reads the three load values of threadstat_cpu() in percent with a scale
+ * of -2. The registry entry's `dev` pointer is ignored.
+ */
+extern const saul_driver_t threadstat_saul_driver;
+
+/**
+ * @brief   Start sampling
+ *
+ * Called by auto_init.
+ */
+void threadstat_init(void);
+
+/**
+ * @brief   Get the statistics of a thread
+ *
+ * The CPU load is 0 until the thread ran through one full interval.
+ *
+ * @param[in]  pid      the thread
+ * @param[out] stat     the thread's statistics
+ *
+ * @return  0 on success
+ * @return  -ENOENT if there is no thread @p pid
+ */
+int threadstat_get(kernel_pid_t pid, threadstat_t *stat);
+
+/**
+ * @brief   Get the total CPU load, i.e. the load of all but the idle thread
+ *
+ * @param[out] load     CPU load in 1/100 percent, indexed by
+ *                      @ref THREADSTAT_LOAD_1 etc.
+ */
+void threadstat_cpu(uint16_t load[THREADSTAT_LOAD_NUMOF]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREADSTAT_H */
+/** @} */
@@ -32,6 +32,18 @@
 #include "xtimer.h"
 #include "thread.h"
 
+/**
+ * @brief   Share of the interval the trickle timers may be delayed by
+ *
+ * The timers of an interval may fire up to I / TRICKLE_SLACK_DIV late, so
+ * they can share a timer interrupt with other timers (see
+ * xtimer_set_msg64_with_slack()). The callback is still sent within the
+ * current interval. Set to 0 to disable.
+ */
+#ifndef TRICKLE_SLACK_DIV
+#define TRICKLE_SLACK_DIV   (16U)
+#endif
+
 /** @brief a generic callback function with arguments that is called by trickle periodically */
 typedef struct {
     void (*func)(void *);       /**< a generic callback function pointer */
@@ -44,7 +44,7 @@ extern "C" {
 
 #ifndef UART_STDIO_RX_BUFSIZE
 /**
- * @brief Buffer size for STDIO
+ * @brief Buffer size for STDIO, must be a power of two
  */
 #define UART_STDIO_RX_BUFSIZE    (64)
 #endif
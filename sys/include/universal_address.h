@@ -11,6 +11,13 @@
  * @ingroup     sys
  * @brief       universal address container
  *
+ * Containers are found by a hash index over their address, so adding and
+ * removing an address takes constant time on average. Each container holds
+ * its address data itself, so the address stays at the same place for as
+ * long as the container is in use. Removed containers are reused for any
+ * address size. On top of the address data, the index takes 2 bytes per
+ * container and 2 bytes per hash bucket (`UNIVERSAL_ADDRESS_HASH_BUCKETS`).
+ *
  * @{
  *
  * @file
@@ -59,6 +66,9 @@ extern "C" {
 typedef struct {
     uint8_t use_count;                       /**< The number of entries link here */
     uint8_t address_size;                    /**< Size in bytes of the used generic address */
+    uint16_t next;                           /**< Index + 1 of the next container in
+                                              *   the same hash bucket or free list
+                                              *   (internal) */
     uint8_t address[UNIVERSAL_ADDRESS_SIZE]; /**< The generic address data */
 } universal_address_container_t;
 
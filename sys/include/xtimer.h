@@ -20,6 +20,12 @@
  * number of active timers.  The reason for this is that multiplexing is
  * realized by next-first singly linked lists.
  *
+ * With the `xtimer_wheel` module, timers are kept in a hierarchical timing
+ * wheel instead (see @ref XTIMER_WHEEL_SHIFT and @ref XTIMER_WHEEL_LEVELS).
+ * Insertion is then O(1), removal only has to search the timers that share a
+ * slot of the wheel. Only timers expiring within the current slot of the
+ * first level are kept in a sorted list.
+ *
  * @{
  * @file
  * @brief   xtimer interface definitions
@@ -291,6 +297,63 @@ static inline void xtimer_set_wakeup64(xtimer_t *timer, uint64_t offset, kernel_
  */
 static inline void xtimer_set(xtimer_t *timer, uint32_t offset);
 
+/**
+ * @brief Set a timer to execute a callback at some time within a window
+ *
+ * Like xtimer_set(), but the callback may be executed up to @p slack
+ * microseconds late. The expiry time is rounded to the most aligned tick
+ * within the window, so timers whose windows contain the same most aligned
+ * tick expire at the same time and share a single timer interrupt. Timers
+ * with overlapping windows are not moved onto a common target otherwise.
+ *
+ * @warning BEWARE! Callbacks from xtimer_set_with_slack() are being executed
+ * in interrupt context. DON'T USE THIS FUNCTION unless you know *exactly*
+ * what that means.
+ *
+ * @param[in] timer     the timer structure to use.
+ *                      Its xtimer_t::target and xtimer_t::long_target
+ *                      fields need to be initialized with 0 on first use
+ * @param[in] offset    earliest time in microseconds from now for the
+ *                      callback's execution
+ * @param[in] slack     time in microseconds the callback's execution may be
+ *                      delayed by
+ */
+static inline void xtimer_set_with_slack(xtimer_t *timer, uint32_t offset, uint32_t slack);
+
+/**
+ * @brief Set a timer that sends a message within a window
+ *
+ * Like xtimer_set_msg(), but the message may be sent up to @p slack
+ * microseconds late, see xtimer_set_with_slack().
+ *
+ * @param[in] timer         timer struct to work with.
+ *                          Its xtimer_t::target and xtimer_t::long_target
+ *                          fields need to be initialized with 0 on first use.
+ * @param[in] offset        earliest time in microseconds from now
+ * @param[in] slack         time in microseconds the message may be delayed by
+ * @param[in] msg           ptr to msg that will be sent
+ * @param[in] target_pid    pid the message will be sent to
+ */
+static inline void xtimer_set_msg_with_slack(xtimer_t *timer, uint32_t offset, uint32_t slack,
+                                             msg_t *msg, kernel_pid_t target_pid);
+
+/**
+ * @brief Set a timer that sends a message within a window, 64bit version
+ *
+ * Like xtimer_set_msg64(), but the message may be sent up to @p slack
+ * microseconds late, see xtimer_set_with_slack().
+ *
+ * @param[in] timer         timer struct to work with.
+ *                          Its xtimer_t::target and xtimer_t::long_target
+ *                          fields need to be initialized with 0 on first use.
+ * @param[in] offset        earliest time in microseconds from now
+ * @param[in] slack         time in microseconds the message may be delayed by
+ * @param[in] msg           ptr to msg that will be sent
+ * @param[in] target_pid    pid the message will be sent to
+ */
+static inline void xtimer_set_msg64_with_slack(xtimer_t *timer, uint64_t offset, uint32_t slack,
+                                               msg_t *msg, kernel_pid_t target_pid);
+
 /**
  * @brief remove a timer
  *
@@ -439,6 +502,28 @@ static inline bool xtimer_less64(xtimer_ticks64_t a, xtimer_ticks64_t b);
  */
 int xtimer_mutex_lock_timeout(mutex_t *mutex, uint64_t us);
 
+#if defined(MODULE_XTIMER_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Timer interrupt statistics
+ */
+typedef struct {
+    uint32_t fired;     /**< number of timers fired from the timer interrupt */
+    uint32_t saved;     /**< number of timers that were fired from an
+                         *   interrupt that already fired another timer,
+                         *   i.e., the number of interrupts saved by
+                         *   coalescing */
+} xtimer_stats_t;
+
+/**
+ * @brief   Get the timer interrupt statistics
+ *
+ * @note    Only available with the `xtimer_stats` module.
+ *
+ * @param[out] stats    the current statistics
+ */
+void xtimer_get_stats(xtimer_stats_t *stats);
+#endif
+
 /**
  * @brief xtimer backoff value
  *
@@ -509,6 +594,43 @@ int xtimer_mutex_lock_timeout(mutex_t *mutex, uint64_t us);
 #define XTIMER_PERIODIC_RELATIVE (512)
 #endif
 
+#ifndef XTIMER_WHEEL_SHIFT
+/**
+ * @brief   Width of a slot of the first timing wheel level, as a power of two
+ *          of hardware ticks
+ *
+ * Only used with the `xtimer_wheel` module. Timers expiring within the current
+ * slot are kept in a sorted list, so smaller slots make adding timers with
+ * short offsets cheaper, at the cost of more timer interrupts for moving
+ * timers between the wheel levels.
+ */
+#define XTIMER_WHEEL_SHIFT (10)
+#endif
+
+#ifndef XTIMER_WHEEL_LEVELS
+/**
+ * @brief   Number of timing wheel levels
+ *
+ * Only used with the `xtimer_wheel` module. Each level has 32 slots, so the
+ * wheel covers 2^(@ref XTIMER_WHEEL_SHIFT + 5 * XTIMER_WHEEL_LEVELS) ticks.
+ * Timers further in the future are kept in an unsorted overflow list that is
+ * checked once per wheel revolution.
+ */
+#define XTIMER_WHEEL_LEVELS (4)
+#endif
+
+#ifndef XTIMER_WHEEL_SLACK
+/**
+ * @brief   Timer coalescing slack, in hardware ticks
+ *
+ * Only used with the `xtimer_wheel` module. If not 0, timer targets are
+ * rounded up to a multiple of this value, so timers set at about the same time
+ * expire together and are handled by a single timer interrupt. Timers fire up
+ * to XTIMER_WHEEL_SLACK - 1 ticks late. Must be 0 or a power of two.
+ */
+#define XTIMER_WHEEL_SLACK (0)
+#endif
+
 #ifndef XTIMER_SHIFT
 /**
  * @brief   xtimer prescaler value
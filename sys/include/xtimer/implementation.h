@@ -33,6 +33,10 @@ extern "C" {
 extern volatile uint32_t _xtimer_high_cnt;
 #endif
 
+#ifdef MODULE_XTIMER_STATS
+extern xtimer_stats_t _xtimer_stats;
+#endif
+
 /**
  * @brief IPC message type for xtimer msg callback
  */
@@ -69,6 +73,9 @@ void _xtimer_set_msg64(xtimer_t *timer, uint64_t offset, msg_t *msg, kernel_pid_
 void _xtimer_set_wakeup(xtimer_t *timer, uint32_t offset, kernel_pid_t pid);
 void _xtimer_set_wakeup64(xtimer_t *timer, uint64_t offset, kernel_pid_t pid);
 void _xtimer_set(xtimer_t *timer, uint32_t offset);
+void _xtimer_set64_with_slack(xtimer_t *timer, uint64_t offset, uint32_t slack);
+void _xtimer_set_msg64_with_slack(xtimer_t *timer, uint64_t offset, uint32_t slack,
+                                  msg_t *msg, kernel_pid_t target_pid);
 int _xtimer_msg_receive_timeout(msg_t *msg, uint32_t ticks);
 int _xtimer_msg_receive_timeout64(msg_t *msg, uint64_t ticks);
 
@@ -216,6 +223,26 @@ static inline void xtimer_set(xtimer_t *timer, uint32_t offset)
     _xtimer_set(timer, _xtimer_ticks_from_usec(offset));
 }
 
+static inline void xtimer_set_with_slack(xtimer_t *timer, uint32_t offset, uint32_t slack)
+{
+    _xtimer_set64_with_slack(timer, _xtimer_ticks_from_usec(offset),
+                             _xtimer_ticks_from_usec(slack));
+}
+
+static inline void xtimer_set_msg_with_slack(xtimer_t *timer, uint32_t offset, uint32_t slack,
+                                             msg_t *msg, kernel_pid_t target_pid)
+{
+    _xtimer_set_msg64_with_slack(timer, _xtimer_ticks_from_usec(offset),
+                                 _xtimer_ticks_from_usec(slack), msg, target_pid);
+}
+
+static inline void xtimer_set_msg64_with_slack(xtimer_t *timer, uint64_t offset, uint32_t slack,
+                                               msg_t *msg, kernel_pid_t target_pid)
+{
+    _xtimer_set_msg64_with_slack(timer, _xtimer_ticks_from_usec64(offset),
+                                 _xtimer_ticks_from_usec(slack), msg, target_pid);
+}
+
 static inline int xtimer_msg_receive_timeout(msg_t *msg, uint32_t timeout)
 {
     return _xtimer_msg_receive_timeout(msg, _xtimer_ticks_from_usec(timeout));
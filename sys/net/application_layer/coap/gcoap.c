@@ -13,7 +13,8 @@
  * @file
  * @brief       GNRC's implementation of CoAP protocol
  *
- * Runs a thread (_pid) to manage request/response messaging.
+ * Runs a thread (_pid) to manage request/response messaging, or uses the
+ * shared event thread with the event_thread module.
  *
  * @author      Ken Bannister <kb2ma@runbox.com>
  */
@@ -23,6 +24,10 @@
 #include "random.h"
 #include "thread.h"
 
+#ifdef MODULE_EVENT_THREAD
+#include "event/thread.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -30,8 +35,13 @@
 #define GCOAP_STACK_SIZE (THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE)
 
 /* Internal functions */
+#ifdef MODULE_EVENT_THREAD
+static void _on_sock_event(event_t *event);
+static void _on_timeout_event(event_t *event);
+#else
 static void *_event_loop(void *arg);
-static void _listen(sock_udp_t *sock);
+#endif
+static ssize_t _listen(sock_udp_t *sock, uint32_t timeout);
 static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len);
 static ssize_t _write_options(coap_pkt_t *pdu, uint8_t *buf, size_t len);
 static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len);
@@ -56,10 +66,31 @@ static gcoap_state_t _coap_state = {
 };
 
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+#ifdef MODULE_EVENT_THREAD
+static event_t _sock_event = { .handler = _on_sock_event };
+#else
 static char _msg_stack[GCOAP_STACK_SIZE];
+#endif
 static sock_udp_t _sock;
 
+#ifdef MODULE_EVENT_THREAD
+/* Reads all packets queued at the sock, posted whenever one arrived. */
+static void _on_sock_event(event_t *event)
+{
+    ssize_t res;
+    (void)event;
+
+    do {
+        res = _listen(&_sock, 0);
+    } while ((res != -EAGAIN) && (res != -EADDRNOTAVAIL));
+}
 
+/* Expires a request, posted by its response timeout. */
+static void _on_timeout_event(event_t *event)
+{
+    _expire_request(container_of(event, gcoap_request_memo_t, timeout_event));
+}
+#else
 /* Event/Message loop for gcoap _pid thread. */
 static void *_event_loop(void *arg)
 {
@@ -81,6 +112,8 @@ static void *_event_loop(void *arg)
     }
 
     while(1) {
+        uint8_t open_reqs;
+
         res = msg_try_receive(&msg_rcvd);
 
         if (res > 0) {
@@ -96,40 +129,37 @@ static void *_event_loop(void *arg)
             }
         }
 
-        _listen(&_sock);
+        gcoap_op_state(&open_reqs);
+        _listen(&_sock, open_reqs > 0 ? GCOAP_RECV_TIMEOUT : SOCK_NO_TIMEOUT);
     }
 
     return 0;
 }
+#endif
 
-/* Listen for an incoming CoAP message. */
-static void _listen(sock_udp_t *sock)
+/* Listen for an incoming CoAP message, returns the result of receiving it. */
+static ssize_t _listen(sock_udp_t *sock, uint32_t timeout)
 {
     coap_pkt_t pdu;
     uint8_t buf[GCOAP_PDU_BUF_SIZE];
     sock_udp_ep_t remote;
     gcoap_request_memo_t *memo = NULL;
-    uint8_t open_reqs;
-
-    gcoap_op_state(&open_reqs);
 
-    ssize_t res = sock_udp_recv(sock, buf, sizeof(buf),
-                                open_reqs > 0 ? GCOAP_RECV_TIMEOUT : SOCK_NO_TIMEOUT,
-                                &remote);
-    if (res <= 0) {
+    ssize_t rcvd = sock_udp_recv(sock, buf, sizeof(buf), timeout, &remote);
+    if (rcvd <= 0) {
 #if ENABLE_DEBUG
-        if (res < 0 && res != -ETIMEDOUT) {
-            DEBUG("gcoap: udp recv failure: %d\n", res);
+        if (rcvd < 0 && rcvd != -ETIMEDOUT && rcvd != -EAGAIN) {
+            DEBUG("gcoap: udp recv failure: %d\n", rcvd);
         }
 #endif
-        return;
+        return rcvd;
     }
 
-    res = coap_parse(&pdu, buf, res);
+    ssize_t res = coap_parse(&pdu, buf, rcvd);
     if (res < 0) {
         DEBUG("gcoap: parse failure: %d\n", res);
         /* If a response, can't clear memo, but it will timeout later. */
-        return;
+        return rcvd;
     }
 
     /* incoming request */
@@ -143,11 +173,16 @@ static void _listen(sock_udp_t *sock)
     else {
         _find_req_memo(&memo, &pdu, buf, sizeof(buf));
         if (memo) {
+#ifdef MODULE_EVENT_THREAD
+            event_timeout_clear(&memo->response_timeout);
+#else
             xtimer_remove(&memo->response_timer);
+#endif
             memo->resp_handler(memo->state, &pdu);
             memo->state = GCOAP_MEMO_UNUSED;
         }
     }
+    return rcvd;
 }
 
 /*
@@ -366,11 +401,35 @@ kernel_pid_t gcoap_init(void)
     if (_pid != KERNEL_PID_UNDEF) {
         return -EEXIST;
     }
+#ifdef MODULE_EVENT_THREAD
+    sock_udp_ep_t local;
+    memset(&local, 0, sizeof(sock_udp_ep_t));
+    local.family = AF_INET6;
+    local.netif  = SOCK_ADDR_ANY_NETIF;
+    local.port   = GCOAP_PORT;
+
+    int res = sock_udp_create(&_sock, &local, NULL, 0);
+    if (res < 0) {
+        DEBUG("gcoap: cannot create sock: %d\n", res);
+        return -EINVAL;
+    }
+    gnrc_sock_set_event(&_sock.reg, &event_thread_queue, &_sock_event);
+    _pid = event_thread_init();
+#else
     _pid = thread_create(_msg_stack, sizeof(_msg_stack), THREAD_PRIORITY_MAIN - 1,
                             THREAD_CREATE_STACKTEST, _event_loop, NULL, "coap");
+#endif
 
     /* Blank list of open requests so we know if an entry is available. */
     memset(&_coap_state.open_reqs[0], 0, sizeof(_coap_state.open_reqs));
+#ifdef MODULE_EVENT_THREAD
+    for (int i = 0; i < GCOAP_REQ_WAITING_MAX; i++) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+        memo->timeout_event.handler = _on_timeout_event;
+        event_timeout_init(&memo->response_timeout, &event_thread_queue,
+                           &memo->timeout_event);
+    }
+#endif
     /* randomize initial value */
     _coap_state.last_message_id = random_uint32() & 0xFFFF;
 
@@ -471,6 +530,12 @@ size_t gcoap_req_send2(uint8_t *buf, size_t len, sock_udp_ep_t *remote,
 
         size_t res = sock_udp_send(&_sock, buf, len, remote);
 
+#ifdef MODULE_EVENT_THREAD
+        if (res && (GCOAP_NON_TIMEOUT > 0)) {
+            /* start response wait timer */
+            event_timeout_set(&memo->response_timeout, GCOAP_NON_TIMEOUT);
+        }
+#else
         if (res && (GCOAP_NON_TIMEOUT > 0)) {
             /* interrupt sock listening (to set a listen timeout) */
             msg_t mbox_msg;
@@ -488,6 +553,7 @@ size_t gcoap_req_send2(uint8_t *buf, size_t len, sock_udp_ep_t *remote,
                 DEBUG("gcoap: can't wake up mbox; no timeout for msg\n");
             }
         }
+#endif
         else if (!res) {
             memo->state = GCOAP_MEMO_UNUSED;
             DEBUG("gcoap: sock send failed: %d\n", res);
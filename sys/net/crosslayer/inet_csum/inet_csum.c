@@ -14,12 +14,55 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+/* 32-bit word that may alias the byte buffer */
+typedef uint32_t __attribute__((__may_alias__)) _word_t;
+
+static inline uint16_t _fold(uint64_t sum)
+{
+    /* the end-around carry of one's complement arithmetic */
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return (sum & 0xffff) + (sum >> 16);
+}
+
+/* sums up 16-bit words in host byte order, @p buf is 16-bit aligned */
+static uint64_t _sum_words(const uint8_t *buf, size_t len)
+{
+    uint64_t sum = 0;
+
+    if (((uintptr_t)buf & 2) && (len >= 2)) {
+        sum += *((const uint16_t *)buf);
+        buf += 2;
+        len -= 2;
+    }
+
+    /* without carry handling, the 64-bit accumulator could take 2^32 words */
+    const _word_t *word = (const _word_t *)buf;
+    for (; len >= 16; len -= 16, word += 4) {
+        sum += word[0];
+        sum += word[1];
+        sum += word[2];
+        sum += word[3];
+    }
+    for (; len >= 4; len -= 4, word++) {
+        sum += *word;
+    }
+    if (len >= 2) {
+        sum += *((const uint16_t *)word);
+    }
+
+    return sum;
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -44,22 +87,39 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
-    for (int i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
+    if ((uintptr_t)buf & 1) {
+        /* no aligned word access possible, group bytes by 16-bit words */
+        for (int i = 0; i < (len >> 1); buf += 2, i++) {
+            csum += (uint16_t)(*buf << 8) + *(buf + 1);
+        }
+    }
+    else {
+        /* the one's complement sum is independent of the byte order, so
+         * words are summed up as they are and swapped once at the end */
+        csum += NTOHS(_fold(_sum_words(buf, len)));
+        buf += len & ~1;
     }
 
     if ((accum_len + len) & 1)          /* if accumulated length is odd */
         csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
 
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
-    }
+    csum = _fold(csum);
 
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
     return csum;
 }
 
+uint16_t inet_csum_update(uint16_t csum, const uint8_t *old, const uint8_t *new,
+                          uint16_t len)
+{
+    /* RFC 1624, eqn. 3: HC' = ~(~HC + ~m + m') */
+    uint32_t sum = (uint16_t)~csum;
+
+    sum += (uint16_t)~inet_csum(0, old, len);
+    sum += inet_csum(0, new, len);
+
+    return ~_fold(sum);
+}
+
 /** @} */
@@ -19,9 +19,11 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 
 #include "msg.h"
 #include "thread.h"
+#include "thread_flags.h"
 
 #include "net/gnrc.h"
 #include "net/gnrc/nettype.h"
@@ -39,7 +41,7 @@
 
 #define NETDEV_NETAPI_MSG_QUEUE_SIZE 8
 
-static void _pass_on_packet(gnrc_pktsnip_t *pkt);
+static void _pass_on_packet(gnrc_netdev_t *gnrc_netdev, gnrc_pktsnip_t *pkt);
 
 /**
  * @brief   Function called by the device driver on device events
@@ -51,14 +53,10 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
     gnrc_netdev_t *gnrc_netdev = (gnrc_netdev_t*) dev->context;
 
     if (event == NETDEV_EVENT_ISR) {
-        msg_t msg;
-
-        msg.type = NETDEV_MSG_TYPE_EVENT;
-        msg.content.ptr = gnrc_netdev;
-
-        if (msg_send(&msg, gnrc_netdev->pid) <= 0) {
-            puts("gnrc_netdev: possibly lost interrupt.");
-        }
+        /* cannot fail like a message into a full queue, and interrupts that
+         * fire before the thread runs are handled by a single isr() call */
+        thread_flags_set((thread_t *)thread_get(gnrc_netdev->pid),
+                         GNRC_NETDEV_THREAD_FLAG_EVENT);
     }
     else {
         DEBUG("gnrc_netdev: event triggered -> %i\n", event);
@@ -68,7 +66,7 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                     gnrc_pktsnip_t *pkt = gnrc_netdev->recv(gnrc_netdev);
 
                     if (pkt) {
-                        _pass_on_packet(pkt);
+                        _pass_on_packet(gnrc_netdev, pkt);
                     }
 
                     break;
@@ -87,8 +85,59 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
     }
 }
 
-static void _pass_on_packet(gnrc_pktsnip_t *pkt)
+#ifdef MODULE_GNRC_NETAPI_BATCH
+/* only packets for the network layers are collected, as they handle batches.
+ * Other subscribers to these types get the packets one by one from
+ * gnrc_netapi_dispatch_receive_batch(), everything else is passed on right
+ * away */
+static inline bool _batchable(gnrc_nettype_t type)
 {
+#ifdef MODULE_GNRC_IPV6
+    if (type == GNRC_NETTYPE_IPV6) {
+        return true;
+    }
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN
+    if (type == GNRC_NETTYPE_SIXLOWPAN) {
+        return true;
+    }
+#endif
+    (void)type;
+    return false;
+}
+
+static void _flush_batch(gnrc_netdev_t *gnrc_netdev)
+{
+    if (gnrc_netdev->rx_batch_numof == 0) {
+        return;
+    }
+    DEBUG("gnrc_netdev: passing on batch of %u packets\n",
+          (unsigned)gnrc_netdev->rx_batch_numof);
+    gnrc_netapi_dispatch_receive_batch(gnrc_netdev->rx_batch[0]->type,
+                                       GNRC_NETREG_DEMUX_CTX_ALL,
+                                       gnrc_netdev->rx_batch,
+                                       gnrc_netdev->rx_batch_numof);
+    gnrc_netdev->rx_batch_numof = 0;
+}
+#endif
+
+static void _pass_on_packet(gnrc_netdev_t *gnrc_netdev, gnrc_pktsnip_t *pkt)
+{
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    if (_batchable(pkt->type)) {
+        if ((gnrc_netdev->rx_batch_numof > 0) &&
+            (gnrc_netdev->rx_batch[0]->type != pkt->type)) {
+            _flush_batch(gnrc_netdev);
+        }
+        gnrc_netdev->rx_batch[gnrc_netdev->rx_batch_numof++] = pkt;
+        if (gnrc_netdev->rx_batch_numof == GNRC_NETAPI_BATCH_SIZE) {
+            _flush_batch(gnrc_netdev);
+        }
+        return;
+    }
+#else
+    (void)gnrc_netdev;
+#endif
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
         DEBUG("gnrc_netdev: unable to forward packet of type %i\n", pkt->type);
@@ -112,6 +161,9 @@ static void *_gnrc_netdev_thread(void *args)
     netdev_t *dev = gnrc_netdev->dev;
 
     gnrc_netdev->pid = thread_getpid();
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    gnrc_netdev->rx_batch_numof = 0;
+#endif
 
     gnrc_netapi_opt_t *opt;
     int res;
@@ -132,8 +184,10 @@ static void *_gnrc_netdev_thread(void *args)
 
     /* start the event loop */
     while (1) {
-        DEBUG("gnrc_netdev: waiting for incoming messages\n");
-        msg_receive(&msg);
+        DEBUG("gnrc_netdev: waiting for device events and messages\n");
+        if (thread_flags_msg_wait_any(GNRC_NETDEV_THREAD_FLAG_EVENT, &msg)) {
+            msg.type = NETDEV_MSG_TYPE_EVENT;
+        }
         /* dispatch NETDEV and NETAPI messages */
         switch (msg.type) {
             case NETDEV_MSG_TYPE_EVENT:
@@ -175,6 +229,15 @@ static void *_gnrc_netdev_thread(void *args)
                 DEBUG("gnrc_netdev: Unknown command %" PRIu16 "\n", msg.type);
                 break;
         }
+#ifdef MODULE_GNRC_NETAPI_BATCH
+        /* keep draining the device while events are pending and pass on
+         * everything received so far in one go once the queue runs dry */
+        if ((msg_avail() == 0) &&
+            !(((thread_t *)sched_active_thread)->flags &
+              GNRC_NETDEV_THREAD_FLAG_EVENT)) {
+            _flush_batch(gnrc_netdev);
+        }
+#endif
     }
     /* never reached */
     return NULL;
@@ -36,9 +36,9 @@ static gnrc_pktsnip_t *_recv(gnrc_netdev_t *gnrc_netdev)
     gnrc_pktsnip_t *pkt = NULL;
 
     if (bytes_expected > 0) {
-        pkt = gnrc_pktbuf_add(NULL, NULL,
-                bytes_expected,
-                GNRC_NETTYPE_UNDEF);
+        /* the device writes the frame straight into the packet buffer, so
+         * that the Ethernet header can be split off without copying */
+        pkt = gnrc_pktbuf_add_rx(bytes_expected, sizeof(ethernet_hdr_t));
 
         if(!pkt) {
             DEBUG("_recv_ethernet_packet: cannot allocate pktsnip.\n");
@@ -145,6 +145,125 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
     return numof;
 }
 
+#ifdef MODULE_GNRC_NETAPI_BATCH
+void gnrc_netapi_batch_accept(gnrc_netreg_entry_t *entry)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    assert(entry->type == GNRC_NETREG_TYPE_DEFAULT);
+#endif
+    entry->batch = true;
+}
+
+static void _release_batch(gnrc_pktsnip_t *batch)
+{
+    for (unsigned i = 0; i < gnrc_netapi_batch_numof(batch); i++) {
+        gnrc_pktbuf_release(gnrc_netapi_batch_get(batch, i));
+    }
+    gnrc_pktbuf_release(batch);
+}
+
+/* dispatches one packet of a batch to a subscriber that does not handle
+ * batches */
+static void _receive_single(gnrc_netreg_entry_t *sendto, gnrc_pktsnip_t *pkt)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    switch (sendto->type) {
+        case GNRC_NETREG_TYPE_DEFAULT:
+            break;
+#ifdef MODULE_GNRC_NETAPI_MBOX
+        case GNRC_NETREG_TYPE_MBOX:
+            if (_snd_rcv_mbox(sendto->target.mbox, GNRC_NETAPI_MSG_TYPE_RCV,
+                              pkt) < 1) {
+                gnrc_pktbuf_release(pkt);
+            }
+            return;
+#endif
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+        case GNRC_NETREG_TYPE_CB:
+            sendto->target.cbd->cb(GNRC_NETAPI_MSG_TYPE_RCV, pkt,
+                                   sendto->target.cbd->ctx);
+            return;
+#endif
+        default:
+            /* unknown dispatch type */
+            gnrc_pktbuf_release(pkt);
+            return;
+    }
+#endif
+    if (_snd_rcv(sendto->target.pid, GNRC_NETAPI_MSG_TYPE_RCV, pkt) < 1) {
+        /* unable to dispatch packet */
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+static inline bool _batch_receiver(const gnrc_netreg_entry_t *sendto)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    if (sendto->type != GNRC_NETREG_TYPE_DEFAULT) {
+        return false;
+    }
+#endif
+    return sendto->batch;
+}
+
+int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t **pkts, unsigned numof)
+{
+    gnrc_pktsnip_t *batch = NULL;
+    int receivers;
+
+    assert((numof > 0) && (numof <= GNRC_NETAPI_BATCH_SIZE));
+    receivers = gnrc_netreg_num(type, demux_ctx);
+    if (receivers == 0) {
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+        return 0;
+    }
+    if (numof > 1) {
+        batch = gnrc_pktbuf_add(NULL, pkts, numof * sizeof(gnrc_pktsnip_t *),
+                                GNRC_NETTYPE_UNDEF);
+    }
+    if (batch == NULL) {
+        /* fall back to dispatching every packet on its own */
+        for (unsigned i = 0; i < numof; i++) {
+            if (!gnrc_netapi_dispatch_receive(type, demux_ctx, pkts[i])) {
+                gnrc_pktbuf_release(pkts[i]);
+            }
+        }
+        return receivers;
+    }
+
+    gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_pktbuf_hold(pkts[i], receivers - 1);
+    }
+    gnrc_pktbuf_hold(batch, receivers - 1);
+
+    while (sendto) {
+        if (_batch_receiver(sendto)) {
+            if (_snd_rcv(sendto->target.pid, GNRC_NETAPI_MSG_TYPE_RCV_BATCH,
+                         batch) < 1) {
+                /* unable to dispatch batch */
+                _release_batch(batch);
+            }
+        }
+        else {
+            /* every packet on its own for subscribers that do not handle
+             * batches */
+            for (unsigned i = 0; i < numof; i++) {
+                _receive_single(sendto, pkts[i]);
+            }
+            gnrc_pktbuf_release(batch);
+        }
+        sendto = gnrc_netreg_getnext(sendto);
+    }
+
+    return receivers;
+}
+#endif
+
 int gnrc_netapi_send(kernel_pid_t pid, gnrc_pktsnip_t *pkt)
 {
     return _snd_rcv(pid, GNRC_NETAPI_MSG_TYPE_SND, pkt);
@@ -27,13 +27,45 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+#if GNRC_NETREG_BUCKETS
+/* bucket reserved for GNRC_NETREG_DEMUX_CTX_ALL */
+#define _BUCKET_ALL         (GNRC_NETREG_BUCKETS)
+#define _BUCKETS_NUMOF      (GNRC_NETREG_BUCKETS + 1)
+#else
+#define _BUCKETS_NUMOF      (1)
+#endif
+
+/* The registry as lookup table by gnrc_nettype_t, hashed by demux context.
+ * Since all entries of a bucket have the same type, gnrc_netreg_getnext() only
+ * has to compare the demux context when following the list. */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][_BUCKETS_NUMOF];
+
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+#if GNRC_NETREG_BUCKETS
+    unsigned idx;
+
+    if (demux_ctx == GNRC_NETREG_DEMUX_CTX_ALL) {
+        idx = _BUCKET_ALL;
+    }
+    else {
+        /* demux contexts are mostly ports or protocol numbers, so fold the
+         * upper bits into the lower ones */
+        idx = (demux_ctx ^ (demux_ctx >> 8) ^ (demux_ctx >> 16)) %
+              GNRC_NETREG_BUCKETS;
+    }
+    return &netreg[type][idx];
+#else
+    (void)demux_ctx;
+    return &netreg[type][0];
+#endif
+}
 
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
@@ -52,8 +84,13 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     if (_INVALID_TYPE(type)) {
         return -EINVAL;
     }
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    entry->batch = false;
+#endif
 
-    LL_PREPEND(netreg[type], entry);
+    gnrc_netreg_entry_t **bucket = _bucket(type, entry->demux_ctx);
+
+    LL_PREPEND(*bucket, entry);
 
     return 0;
 }
@@ -64,7 +101,9 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
-    LL_DELETE(netreg[type], entry);
+    gnrc_netreg_entry_t **bucket = _bucket(type, entry->demux_ctx);
+
+    LL_DELETE(*bucket, entry);
 }
 
 gnrc_netreg_entry_t *gnrc_netreg_lookup(gnrc_nettype_t type, uint32_t demux_ctx)
@@ -75,7 +114,9 @@ gnrc_netreg_entry_t *gnrc_netreg_lookup(gnrc_nettype_t type, uint32_t demux_ctx)
         return NULL;
     }
 
-    LL_SEARCH_SCALAR(netreg[type], res, demux_ctx, demux_ctx);
+    gnrc_netreg_entry_t **bucket = _bucket(type, demux_ctx);
+
+    LL_SEARCH_SCALAR(*bucket, res, demux_ctx, demux_ctx);
 
     return res;
 }
@@ -89,7 +130,7 @@ int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx)
         return 0;
     }
 
-    entry = netreg[type];
+    entry = *_bucket(type, demux_ctx);
 
     while (entry != NULL) {
         if (entry->demux_ctx == demux_ctx) {
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <string.h>
+
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/dc.h"
+#include "net/gnrc/ipv6/nc.h"
+#include "net/gnrc/ipv6/netif.h"
+
+#ifdef MODULE_FIB
+#include "net/fib.h"
+#endif
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#if ENABLE_DEBUG
+static char addr_str[IPV6_ADDR_MAX_STR_LEN];
+#endif
+
+/* only used by the IPv6 thread, so there is no locking */
+static gnrc_ipv6_dc_t _dcache[GNRC_IPV6_DC_SIZE];
+static unsigned _next;
+
+unsigned gnrc_ipv6_dc_generation(void)
+{
+    /* all generations only ever grow, so their sum only stays the same if
+     * none of them changed */
+    unsigned generation = gnrc_ipv6_nc_generation + gnrc_ipv6_netif_generation;
+
+#ifdef MODULE_FIB
+    generation += fib_get_generation(&gnrc_ipv6_fib_table);
+#endif
+    return generation;
+}
+
+static gnrc_ipv6_dc_t *_find(kernel_pid_t iface, const ipv6_addr_t *dst)
+{
+    for (unsigned i = 0; i < GNRC_IPV6_DC_SIZE; i++) {
+        gnrc_ipv6_dc_t *entry = &_dcache[i];
+
+        if ((entry->iface != KERNEL_PID_UNDEF) && (entry->lookup_iface == iface) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+gnrc_ipv6_dc_t *gnrc_ipv6_dc_get(kernel_pid_t iface, const ipv6_addr_t *dst)
+{
+    gnrc_ipv6_dc_t *entry = _find(iface, dst);
+
+    if ((entry == NULL) || (entry->generation != gnrc_ipv6_dc_generation())) {
+        return NULL;
+    }
+    DEBUG("ipv6_dc: hit for %s\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    return entry;
+}
+
+gnrc_ipv6_dc_t *gnrc_ipv6_dc_add(kernel_pid_t iface, const ipv6_addr_t *dst,
+                                 unsigned generation)
+{
+    gnrc_ipv6_dc_t *entry = _find(iface, dst);
+
+    if (entry == NULL) {
+        entry = &_dcache[_next];
+        _next = (_next + 1) % GNRC_IPV6_DC_SIZE;
+    }
+    DEBUG("ipv6_dc: add %s\n", ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    memset(entry, 0, sizeof(*entry));
+    memcpy(&entry->dst, dst, sizeof(ipv6_addr_t));
+    entry->generation = generation;
+    entry->lookup_iface = iface;
+    return entry;
+}
+
+/** @} */
@@ -29,6 +29,7 @@
 #include "thread.h"
 #include "utlist.h"
 
+#include "net/gnrc/ipv6/dc.h"
 #include "net/gnrc/ipv6/nc.h"
 #include "net/gnrc/ipv6/netif.h"
 #include "net/gnrc/ipv6/whitelist.h"
@@ -54,6 +55,12 @@ static char _stack[GNRC_IPV6_STACK_SIZE];
  * @brief buffer to store the entries in the IPv6 forwarding table
  */
 static fib_entry_t _fib_entries[GNRC_IPV6_FIB_TABLE_SIZE];
+#ifdef MODULE_FIB_TRIE
+/**
+ * @brief buffer to store the nodes of the trie over the forwarding table
+ */
+static fib_trie_node_t _fib_trie_pool[FIB_TRIE_POOL_SIZE(GNRC_IPV6_FIB_TABLE_SIZE)];
+#endif
 
 /**
  * @brief the IPv6 forwarding table
@@ -91,6 +98,10 @@ kernel_pid_t gnrc_ipv6_init(void)
     gnrc_ipv6_fib_table.data.entries = _fib_entries;
     gnrc_ipv6_fib_table.table_type = FIB_TABLE_TYPE_SH;
     gnrc_ipv6_fib_table.size = GNRC_IPV6_FIB_TABLE_SIZE;
+#ifdef MODULE_FIB_TRIE
+    gnrc_ipv6_fib_table.trie_pool = _fib_trie_pool;
+    gnrc_ipv6_fib_table.trie_pool_size = FIB_TRIE_POOL_SIZE(GNRC_IPV6_FIB_TABLE_SIZE);
+#endif
     fib_init(&gnrc_ipv6_fib_table);
 #endif
 
@@ -259,6 +270,9 @@ static void *_event_loop(void *args)
 
     /* register interest in all IPv6 packets */
     gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    gnrc_netapi_batch_accept(&me_reg);
+#endif
 
     /* preinitialize ACK */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
@@ -274,6 +288,19 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+#ifdef MODULE_GNRC_NETAPI_BATCH
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH: {
+                gnrc_pktsnip_t *batch = msg.content.ptr;
+
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(batch); i++) {
+                    _receive(gnrc_netapi_batch_get(batch, i));
+                }
+                gnrc_pktbuf_release(batch);
+                break;
+            }
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr, true);
@@ -290,6 +317,7 @@ static void *_event_loop(void *args)
             case GNRC_NDP_MSG_RTR_TIMEOUT:
                 DEBUG("ipv6: Router timeout received\n");
                 ((gnrc_ipv6_nc_t *)msg.content.ptr)->flags &= ~GNRC_IPV6_NC_IS_ROUTER;
+                gnrc_ipv6_nc_changed();
                 break;
 
             /* XXX reactivate when https://github.com/RIOT-OS/RIOT/issues/5122 is
@@ -654,6 +682,35 @@ static inline kernel_pid_t _next_hop_l2addr(uint8_t *l2addr, uint8_t *l2addr_len
     return found_iface;
 }
 
+#ifdef MODULE_GNRC_IPV6_DC
+/* gets the next hop for dst from the destination cache and looks it up on a
+ * miss */
+static gnrc_ipv6_dc_t *_dc_get(kernel_pid_t iface, ipv6_addr_t *dst,
+                               gnrc_pktsnip_t *pkt)
+{
+    gnrc_ipv6_dc_t *entry = gnrc_ipv6_dc_get(iface, dst);
+
+    if (entry == NULL) {
+        /* changes during the lookup invalidate the new entry */
+        unsigned generation = gnrc_ipv6_dc_generation();
+        uint8_t l2addr_len = GNRC_IPV6_NC_L2_ADDR_MAX;
+        uint8_t l2addr[l2addr_len];
+        kernel_pid_t found_iface = _next_hop_l2addr(l2addr, &l2addr_len,
+                                                    iface, dst, pkt);
+
+        if (found_iface == KERNEL_PID_UNDEF) {
+            return NULL;
+        }
+        entry = gnrc_ipv6_dc_add(iface, dst, generation);
+        entry->iface = found_iface;
+        entry->mtu = gnrc_ipv6_netif_get(found_iface)->mtu;
+        entry->l2_addr_len = l2addr_len;
+        memcpy(entry->l2_addr, l2addr, l2addr_len);
+    }
+    return entry;
+}
+#endif
+
 static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
 {
     kernel_pid_t iface = KERNEL_PID_UNDEF;
@@ -744,6 +801,39 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
         }
     }
     else {
+#ifdef MODULE_GNRC_IPV6_DC
+        gnrc_ipv6_dc_t *dc = _dc_get(iface, &hdr->dst, pkt);
+
+        if (dc == NULL) {
+            DEBUG("ipv6: error determining next hop's link layer address\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+
+        if (prep_hdr) {
+            if (ipv6_addr_is_unspecified(&hdr->src)) {
+                /* the source address is only selected when first needed, so
+                 * forwarded packets don't pay for it */
+                if (ipv6_addr_is_unspecified(&dc->src)) {
+                    ipv6_addr_t *src = gnrc_ipv6_netif_find_best_src_addr(dc->iface,
+                                                                          &hdr->dst,
+                                                                          false);
+                    if (src != NULL) {
+                        memcpy(&dc->src, src, sizeof(ipv6_addr_t));
+                    }
+                }
+                /* if still unspecified, _fill_ipv6_hdr() tries again */
+                memcpy(&hdr->src, &dc->src, sizeof(ipv6_addr_t));
+            }
+            if (_fill_ipv6_hdr(dc->iface, ipv6, payload) < 0) {
+                /* error on filling up header */
+                gnrc_pktbuf_release(pkt);
+                return;
+            }
+        }
+
+        _send_unicast(dc->iface, dc->l2_addr, dc->l2_addr_len, pkt);
+#else
         uint8_t l2addr_len = GNRC_IPV6_NC_L2_ADDR_MAX;
         uint8_t l2addr[l2addr_len];
 
@@ -764,8 +854,111 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
         }
 
         _send_unicast(iface, l2addr, l2addr_len, pkt);
+#endif
+    }
+}
+
+#ifdef MODULE_GNRC_IPV6_ROUTER
+/* Forwards a packet that is not for this node. The IPv6 header is complete
+ * already, so unlike _send() this only looks up the next hop for unicast
+ * destinations. Snips are only copied if they are shared, and the netif
+ * header of the incoming link is reused for the outgoing one.
+ * pkt: packet in receive order, IPv6 header (and netif header) last
+ * netif: netif header of pkt, may be NULL */
+static void _forward(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *netif)
+{
+    gnrc_pktsnip_t *reversed_pkt = NULL, *ptr = pkt;
+    ipv6_hdr_t *hdr;
+    kernel_pid_t iface;
+    uint8_t *l2addr = NULL;
+    uint8_t l2addr_len = 0;
+
+    assert((netif == NULL) || (netif->next == NULL));
+    DEBUG("ipv6: forward packet to next hop\n");
+
+    /* reverse packet snip list order, which detaches the netif header */
+    while (ptr != netif) {
+        gnrc_pktsnip_t *next, *tmp = gnrc_pktbuf_start_write(ptr); /* duplicate
+                                                                    * if shared */
+        if (tmp == NULL) {
+            DEBUG("ipv6: unable to get write access to packet: dropping it\n");
+            gnrc_pktbuf_release(reversed_pkt);
+            gnrc_pktbuf_release(ptr);   /* the snips from ptr on are still linked */
+            return;
+        }
+        ptr = tmp;
+        next = ptr->next;
+        ptr->next = reversed_pkt;
+        reversed_pkt = ptr;
+        ptr = next;
+    }
+    if (netif != NULL) {
+        if ((ptr = gnrc_pktbuf_start_write(netif)) == NULL) {
+            gnrc_pktbuf_release(netif);
+        }
+        netif = ptr;
+    }
+
+    /* the IPv6 header is the first snip now */
+    hdr = reversed_pkt->data;
+    hdr->hl--;
+    DEBUG("ipv6: decremented hop limit to %u\n", hdr->hl);
+
+    if (ipv6_addr_is_multicast(&hdr->dst)) {
+        if (netif != NULL) {
+            gnrc_pktbuf_release(netif);
+        }
+        _send(reversed_pkt, false);
+        return;
+    }
+
+#ifdef MODULE_GNRC_IPV6_DC
+    gnrc_ipv6_dc_t *dc = _dc_get(KERNEL_PID_UNDEF, &hdr->dst, reversed_pkt);
+
+    iface = KERNEL_PID_UNDEF;
+    if (dc != NULL) {
+        iface = dc->iface;
+        l2addr = dc->l2_addr;
+        l2addr_len = dc->l2_addr_len;
+    }
+#else
+    uint8_t l2addr_buf[GNRC_IPV6_NC_L2_ADDR_MAX];
+
+    l2addr = l2addr_buf;
+    l2addr_len = sizeof(l2addr_buf);
+    iface = _next_hop_l2addr(l2addr, &l2addr_len, KERNEL_PID_UNDEF, &hdr->dst,
+                             reversed_pkt);
+#endif
+    if (iface == KERNEL_PID_UNDEF) {
+        DEBUG("ipv6: error determining next hop's link layer address\n");
+        if (netif != NULL) {
+            gnrc_pktbuf_release(netif);
+        }
+        gnrc_pktbuf_release(reversed_pkt);
+        return;
+    }
+
+    /* a netif header from the incoming link has room for the next hop's
+     * address, unless the outgoing link layer uses longer addresses */
+    if ((netif != NULL) && (netif->size >= (sizeof(gnrc_netif_hdr_t) + l2addr_len)) &&
+        (gnrc_pktbuf_realloc_data(netif, sizeof(gnrc_netif_hdr_t) + l2addr_len) == 0)) {
+        gnrc_netif_hdr_init(netif->data, 0, l2addr_len);
+        gnrc_netif_hdr_set_dst_addr(netif->data, l2addr, l2addr_len);
+        netif->next = reversed_pkt;
+        DEBUG("ipv6: send unicast over interface %" PRIkernel_pid "\n", iface);
+#ifdef MODULE_NETSTATS_IPV6
+        gnrc_ipv6_netif_get_stats(iface)->tx_unicast_count++;
+#endif
+        _send_to_iface(iface, netif);
+    }
+    else {
+        if (netif != NULL) {
+            gnrc_pktbuf_release(netif);
+        }
+        _send_unicast(iface, l2addr, l2addr_len, reversed_pkt);
     }
 }
+#endif /* MODULE_GNRC_IPV6_ROUTER */
 
 /* functions for receiving */
 static inline bool _pkt_not_for_me(kernel_pid_t *iface, ipv6_hdr_t *hdr)
@@ -906,8 +1099,6 @@ static void _receive(gnrc_pktsnip_t *pkt)
 
 #ifdef MODULE_GNRC_IPV6_ROUTER    /* only routers redirect */
         /* redirect to next hop */
-        DEBUG("ipv6: decrement hop limit to %u\n", (uint8_t) (hdr->hl - 1));
-
         /* RFC 4291, section 2.5.6 states: "Routers must not forward any
          * packets with Link-Local source or destination addresses to other
          * links."
@@ -919,41 +1110,8 @@ static void _receive(gnrc_pktsnip_t *pkt)
             return;
         }
         /* TODO: check if receiving interface is router */
-        else if (--(hdr->hl) > 0) {  /* drop packets that *reach* Hop Limit 0 */
-            gnrc_pktsnip_t *reversed_pkt = NULL, *ptr = pkt;
-
-            DEBUG("ipv6: forward packet to next hop\n");
-
-            /* pkt might not be writable yet, if header was given above */
-            ipv6 = gnrc_pktbuf_start_write(ipv6);
-            if (ipv6 == NULL) {
-                DEBUG("ipv6: unable to get write access to packet: dropping it\n");
-                gnrc_pktbuf_release(pkt);
-                return;
-            }
-
-            /* remove L2 headers around IPV6 */
-            netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
-            if (netif != NULL) {
-                gnrc_pktbuf_remove_snip(pkt, netif);
-            }
-
-            /* reverse packet snip list order */
-            while (ptr != NULL) {
-                gnrc_pktsnip_t *next;
-                ptr = gnrc_pktbuf_start_write(ptr);     /* duplicate if not already done */
-                if (ptr == NULL) {
-                    DEBUG("ipv6: unable to get write access to packet: dropping it\n");
-                    gnrc_pktbuf_release(reversed_pkt);
-                    gnrc_pktbuf_release(pkt);
-                    return;
-                }
-                next = ptr->next;
-                ptr->next = reversed_pkt;
-                reversed_pkt = ptr;
-                ptr = next;
-            }
-            _send(reversed_pkt, false);
+        else if (hdr->hl > 1) {  /* drop packets that *reach* Hop Limit 0 */
+            _forward(pkt, netif);
             return;
         }
         else {
@@ -22,6 +22,7 @@
 #include "net/gnrc/ndp.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/sixlowpan/nd.h"
+#include "irq.h"
 #include "thread.h"
 #include "xtimer.h"
 
@@ -37,10 +38,106 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 static gnrc_ipv6_nc_t ncache[GNRC_IPV6_NC_SIZE];
 
+volatile unsigned gnrc_ipv6_nc_generation;
+
+/* The hash index is kept apart from the entries. Entries are linked by their
+ * index + 1, so 0 (and a zeroed array) marks the end of a list. _chain links
+ * the entries of a hash bucket, or the removed entries. Entries from _unused
+ * on were never used. */
+static uint16_t _buckets[GNRC_IPV6_NC_HASH_SIZE];
+static uint16_t _chain[GNRC_IPV6_NC_SIZE];
+static uint16_t _free;
+static uint16_t _unused;
+/* time stamps of the last use, in lookups. Lookups may run in several
+ * threads (e.g. IPv6 and the shell), so every use writes them with
+ * interrupts disabled. A hit only sets two independent words, while a linked
+ * LRU list would have to be relinked on every hit. */
+static uint32_t _last_used[GNRC_IPV6_NC_SIZE];
+static uint32_t _lookups;
+/* only a hint, lookups check that it still matches */
+static gnrc_ipv6_nc_t *_last_hit;
+
+static inline unsigned _idx(const gnrc_ipv6_nc_t *entry)
+{
+    return entry - ncache;
+}
+
+static inline uint16_t *_bucket(const ipv6_addr_t *ipv6_addr)
+{
+    uint32_t hash = ipv6_addr->u32[0].u32 ^ ipv6_addr->u32[1].u32 ^
+                    ipv6_addr->u32[2].u32 ^ ipv6_addr->u32[3].u32;
+
+    /* multiplicative hashing, the upper bits are mixed best */
+    hash = (hash * 0x9e3779b1UL) >> 16;
+    return &_buckets[hash % GNRC_IPV6_NC_HASH_SIZE];
+}
+
+static inline bool _match(const gnrc_ipv6_nc_t *entry, kernel_pid_t iface,
+                          const ipv6_addr_t *ipv6_addr)
+{
+    return ((entry->iface == KERNEL_PID_UNDEF) || (iface == KERNEL_PID_UNDEF) ||
+            (iface == entry->iface)) &&
+           ipv6_addr_equal(&(entry->ipv6_addr), ipv6_addr);
+}
+
+static void _used(gnrc_ipv6_nc_t *entry)
+{
+    unsigned state = irq_disable();
+
+    _last_used[_idx(entry)] = ++_lookups;
+    irq_restore(state);
+}
+
+static gnrc_ipv6_nc_t *_lookup(kernel_pid_t iface, const ipv6_addr_t *ipv6_addr)
+{
+    gnrc_ipv6_nc_t *entry = _last_hit;
+
+    if ((entry == NULL) || !_match(entry, iface, ipv6_addr)) {
+        uint16_t i = *_bucket(ipv6_addr);
+
+        for (entry = NULL; i != 0; i = _chain[i - 1]) {
+            if (_match(&ncache[i - 1], iface, ipv6_addr)) {
+                entry = &ncache[i - 1];
+                break;
+            }
+        }
+        if (entry == NULL) {
+            return NULL;
+        }
+        unsigned state = irq_disable();
+        /* don't cache an entry that was removed meanwhile */
+        if (ipv6_addr_equal(&entry->ipv6_addr, ipv6_addr)) {
+            _last_hit = entry;
+        }
+        irq_restore(state);
+    }
+    _used(entry);
+    return entry;
+}
+
+static void _unlink(gnrc_ipv6_nc_t *entry)
+{
+    uint16_t i = _idx(entry) + 1;
+
+    for (uint16_t *next = _bucket(&entry->ipv6_addr); *next != 0;
+         next = &_chain[*next - 1]) {
+        if (*next == i) {
+            *next = _chain[i - 1];
+            break;
+        }
+    }
+    /* put it on the free list */
+    _chain[i - 1] = _free;
+    _free = i;
+    if (_last_hit == entry) {
+        _last_hit = NULL;
+    }
+}
+
 static void _nc_remove(kernel_pid_t iface, gnrc_ipv6_nc_t *entry)
 {
     (void) iface;
-    if (entry == NULL) {
+    if ((entry == NULL) || ipv6_addr_is_unspecified(&(entry->ipv6_addr))) {
         return;
     }
 
@@ -73,9 +170,11 @@ static void _nc_remove(kernel_pid_t iface, gnrc_ipv6_nc_t *entry)
     xtimer_remove(&entry->nbr_sol_timer);
     xtimer_remove(&entry->nbr_adv_timer);
 
+    _unlink(entry);
     ipv6_addr_set_unspecified(&(entry->ipv6_addr));
     entry->iface = KERNEL_PID_UNDEF;
     entry->flags = 0;
+    gnrc_ipv6_nc_changed();
 }
 
 void gnrc_ipv6_nc_init(void)
@@ -86,17 +185,49 @@ void gnrc_ipv6_nc_init(void)
         _nc_remove(entry->iface, entry);
     }
     memset(ncache, 0, sizeof(ncache));
+    memset(_buckets, 0, sizeof(_buckets));
+    memset(_last_used, 0, sizeof(_last_used));
+    _lookups = 0;
+    _last_hit = NULL;
+    _free = 0;
+    _unused = 0;
+}
+
+static bool _is_evictable(const gnrc_ipv6_nc_t *entry)
+{
+    /* registrations (RFC 6775) and routers are only removed by timeout */
+    return (gnrc_ipv6_nc_get_state(entry) == GNRC_IPV6_NC_STATE_STALE) &&
+           (gnrc_ipv6_nc_get_type(entry) != GNRC_IPV6_NC_TYPE_REGISTERED) &&
+           !(entry->flags & GNRC_IPV6_NC_IS_ROUTER);
 }
 
-gnrc_ipv6_nc_t *_find_free_entry(void)
+static gnrc_ipv6_nc_t *_find_free_entry(void)
 {
-    for (int i = 0; i < GNRC_IPV6_NC_SIZE; i++) {
-        if (ipv6_addr_is_unspecified(&(ncache[i].ipv6_addr))) {
-            return ncache + i;
+    if ((_free == 0) && (_unused < GNRC_IPV6_NC_SIZE)) {
+        return &ncache[_unused++];
+    }
+    if (_free == 0) {
+        /* cache is full, evict the least recently used STALE entry */
+        gnrc_ipv6_nc_t *lru = NULL;
+
+        for (unsigned i = 0; i < GNRC_IPV6_NC_SIZE; i++) {
+            if (_is_evictable(&ncache[i]) &&
+                ((lru == NULL) ||
+                 ((int32_t)(_last_used[i] - _last_used[_idx(lru)]) < 0))) {
+                lru = &ncache[i];
+            }
+        }
+        if (lru == NULL) {
+            return NULL;
         }
+        DEBUG("ipv6_nc: evicting %s\n",
+              ipv6_addr_to_str(addr_str, &(lru->ipv6_addr), sizeof(addr_str)));
+        _nc_remove(lru->iface, lru);
     }
 
-    return NULL;
+    gnrc_ipv6_nc_t *entry = &ncache[_free - 1];
+    _free = _chain[_free - 1];
+    return entry;
 }
 
 gnrc_ipv6_nc_t *gnrc_ipv6_nc_add(kernel_pid_t iface, const ipv6_addr_t *ipv6_addr,
@@ -114,32 +245,29 @@ gnrc_ipv6_nc_t *gnrc_ipv6_nc_add(kernel_pid_t iface, const ipv6_addr_t *ipv6_add
         return NULL;
     }
 
-    for (int i = 0; i < GNRC_IPV6_NC_SIZE; i++) {
-        if (ipv6_addr_equal(&(ncache[i].ipv6_addr), ipv6_addr)) {
-            DEBUG("ipv6_nc: Address %s already registered.\n",
-                  ipv6_addr_to_str(addr_str, ipv6_addr, sizeof(addr_str)));
+    /* addresses are unique over all interfaces */
+    gnrc_ipv6_nc_t *entry = _lookup(KERNEL_PID_UNDEF, ipv6_addr);
 
-            if ((l2_addr != NULL) && (l2_addr_len > 0)) {
-                DEBUG("ipv6_nc: Update to L2 address %s",
-                      gnrc_netif_addr_to_str(addr_str, sizeof(addr_str),
-                                             l2_addr, l2_addr_len));
+    if (entry != NULL) {
+        DEBUG("ipv6_nc: Address %s already registered.\n",
+              ipv6_addr_to_str(addr_str, ipv6_addr, sizeof(addr_str)));
 
-                memcpy(&(ncache[i].l2_addr), l2_addr, l2_addr_len);
-                ncache[i].l2_addr_len = l2_addr_len;
-                ncache[i].flags = flags;
-                DEBUG(" with flags = 0x%0x\n", flags);
+        if ((l2_addr != NULL) && (l2_addr_len > 0)) {
+            DEBUG("ipv6_nc: Update to L2 address %s",
+                  gnrc_netif_addr_to_str(addr_str, sizeof(addr_str),
+                                         l2_addr, l2_addr_len));
 
-            }
-            return &ncache[i];
-        }
+            memcpy(&(entry->l2_addr), l2_addr, l2_addr_len);
+            entry->l2_addr_len = l2_addr_len;
+            entry->flags = flags;
+            gnrc_ipv6_nc_changed();
+            DEBUG(" with flags = 0x%0x\n", flags);
 
-        if (ipv6_addr_is_unspecified(&(ncache[i].ipv6_addr)) && !free_entry) {
-            /* found the first free entry */
-            free_entry = &ncache[i];
         }
+        return entry;
     }
 
-    if (!free_entry) {
+    if (!(free_entry = _find_free_entry())) {
         /* reached end of NC without finding updateable or free entry */
         DEBUG("ipv6_nc: neighbor cache full.\n");
         return NULL;
@@ -152,6 +280,10 @@ gnrc_ipv6_nc_t *gnrc_ipv6_nc_add(kernel_pid_t iface, const ipv6_addr_t *ipv6_add
     free_entry->pkts = NULL;
 #endif
     memcpy(&(free_entry->ipv6_addr), ipv6_addr, sizeof(ipv6_addr_t));
+    uint16_t *bucket = _bucket(ipv6_addr);
+    _chain[_idx(free_entry)] = *bucket;
+    *bucket = _idx(free_entry) + 1;
+    _used(free_entry);
     DEBUG("ipv6_nc: Register %s for interface %" PRIkernel_pid,
           ipv6_addr_to_str(addr_str, ipv6_addr, sizeof(addr_str)),
           iface);
@@ -187,6 +319,7 @@ gnrc_ipv6_nc_t *gnrc_ipv6_nc_add(kernel_pid_t iface, const ipv6_addr_t *ipv6_add
 #endif
 
     free_entry->nbr_sol_msg.content.ptr = free_entry;
+    gnrc_ipv6_nc_changed();
 
     return free_entry;
 }
@@ -204,20 +337,16 @@ gnrc_ipv6_nc_t *gnrc_ipv6_nc_get(kernel_pid_t iface, const ipv6_addr_t *ipv6_add
         return NULL;
     }
 
-    for (int i = 0; i < GNRC_IPV6_NC_SIZE; i++) {
-        if (((ncache[i].iface == KERNEL_PID_UNDEF) || (iface == KERNEL_PID_UNDEF) ||
-             (iface == ncache[i].iface)) &&
-            ipv6_addr_equal(&(ncache[i].ipv6_addr), ipv6_addr)) {
-            DEBUG("ipv6_nc: Found entry for %s on interface %" PRIkernel_pid
-                  " (0 = all interfaces) [%p]\n",
-                  ipv6_addr_to_str(addr_str, ipv6_addr, sizeof(addr_str)),
-                  iface, (void *)(ncache + i));
+    gnrc_ipv6_nc_t *entry = _lookup(iface, ipv6_addr);
 
-            return ncache + i;
-        }
+    if (entry != NULL) {
+        DEBUG("ipv6_nc: Found entry for %s on interface %" PRIkernel_pid
+              " (0 = all interfaces) [%p]\n",
+              ipv6_addr_to_str(addr_str, ipv6_addr, sizeof(addr_str)),
+              iface, (void *)entry);
     }
 
-    return NULL;
+    return entry;
 }
 
 gnrc_ipv6_nc_t *gnrc_ipv6_nc_get_next(gnrc_ipv6_nc_t *prev)
@@ -273,6 +402,9 @@ gnrc_ipv6_nc_t *gnrc_ipv6_nc_still_reachable(const ipv6_addr_t *ipv6_addr)
 
         DEBUG("ipv6_nc: Marking entry %s as reachable\n",
               ipv6_addr_to_str(addr_str, ipv6_addr, sizeof(addr_str)));
+        if (gnrc_ipv6_nc_get_state(entry) != GNRC_IPV6_NC_STATE_REACHABLE) {
+            gnrc_ipv6_nc_changed();
+        }
         entry->flags &= ~(GNRC_IPV6_NC_STATE_MASK >> GNRC_IPV6_NC_STATE_POS);
         entry->flags |= (GNRC_IPV6_NC_STATE_REACHABLE >> GNRC_IPV6_NC_STATE_POS);
     }
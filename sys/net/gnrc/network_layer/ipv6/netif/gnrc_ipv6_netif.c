@@ -53,6 +53,8 @@
 
 static gnrc_ipv6_netif_t ipv6_ifs[GNRC_NETIF_NUMOF];
 
+volatile unsigned gnrc_ipv6_netif_generation;
+
 #if ENABLE_DEBUG
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #endif
@@ -157,6 +159,7 @@ static ipv6_addr_t *_add_addr_to_entry(gnrc_ipv6_netif_t *entry, const ipv6_addr
 
     tmp_addr->valid_timeout_msg.type = GNRC_NDP_MSG_ADDR_TIMEOUT;
     tmp_addr->valid_timeout_msg.content.ptr = &tmp_addr->addr;
+    gnrc_ipv6_netif_changed();
 
     return &(tmp_addr->addr);
 }
@@ -165,6 +168,7 @@ static void _reset_addr_from_entry(gnrc_ipv6_netif_t *entry)
 {
     DEBUG("ipv6 netif: Reset IPv6 addresses on interface %" PRIkernel_pid "\n", entry->pid);
     memset(entry->addrs, 0, sizeof(entry->addrs));
+    gnrc_ipv6_netif_changed();
 }
 
 static void _ipv6_netif_remove(gnrc_ipv6_netif_t *entry)
@@ -186,6 +190,7 @@ static void _ipv6_netif_remove(gnrc_ipv6_netif_t *entry)
     DEBUG("ipv6 netif: Remove IPv6 interface %" PRIkernel_pid "\n", entry->pid);
     entry->pid = KERNEL_PID_UNDEF;
     entry->flags = 0;
+    gnrc_ipv6_netif_changed();
 
     mutex_unlock(&entry->mutex);
 }
@@ -322,6 +327,7 @@ static void _remove_addr_from_entry(gnrc_ipv6_netif_t *entry, ipv6_addr_t *addr)
                   ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), entry->pid);
             ipv6_addr_set_unspecified(&(entry->addrs[i].addr));
             entry->addrs[i].flags = 0;
+            gnrc_ipv6_netif_changed();
 #ifdef MODULE_GNRC_NDP_ROUTER
             /* Removal of prefixes MAY allow the router to retransmit up to
              * GNRC_NDP_MAX_INIT_RTR_ADV_NUMOF unsolicited RA
@@ -533,74 +539,6 @@ kernel_pid_t gnrc_ipv6_netif_find_by_prefix(ipv6_addr_t **out, const ipv6_addr_t
     return res;
 }
 
-/**
- * @brief selects potential source address candidates
- * @see <a href="http://tools.ietf.org/html/rfc6724#section-4">
- *      RFC6724, section 4
- *      </a>
- * @param[in]  iface            the interface used for sending
- * @param[in]  dst              the destination address
- * @param[out] candidate_set    a bitfield representing all addresses
- *                              configured to @p iface, potential candidates
- *                              will be marked as 1
- *
- * @return false if no candidates were found
- * @return true otherwise
- *
- * @pre the interface entry and its set of addresses must not be changed during
- *      runtime of this function
- */
-static int _create_candidate_set(gnrc_ipv6_netif_t *iface, const ipv6_addr_t *dst,
-                                 uint8_t *candidate_set, bool link_local_only)
-{
-    int res = -1;
-
-    DEBUG("gathering candidates\n");
-
-    /* currently this implementation supports only addresses as source address
-     * candidates assigned to this interface. Thus we assume all addresses to be
-     * on interface @p iface */
-    (void) dst;
-
-    for (int i = 0; i < GNRC_IPV6_NETIF_ADDR_NUMOF; i++) {
-        gnrc_ipv6_netif_addr_t *iter = &(iface->addrs[i]);
-
-        DEBUG("Checking address: %s\n",
-              ipv6_addr_to_str(addr_str, &(iter->addr), sizeof(addr_str)));
-
-        /* "In any case, multicast addresses and the unspecified address MUST NOT
-         *  be included in a candidate set."
-         */
-        if (ipv6_addr_is_multicast(&(iter->addr)) ||
-            ipv6_addr_is_unspecified(&(iter->addr))) {
-            continue;
-        }
-
-        /* Check if we only want link local addresses */
-        if (link_local_only && !ipv6_addr_is_link_local(&(iter->addr))) {
-            continue;
-        }
-
-        /* "For all multicast and link-local destination addresses, the set of
-         *  candidate source addresses MUST only include addresses assigned to
-         *  interfaces belonging to the same link as the outgoing interface."
-         *
-         * "For site-local unicast destination addresses, the set of candidate
-         *  source addresses MUST only include addresses assigned to interfaces
-         *  belonging to the same site as the outgoing interface."
-         *  -> we should also be fine, since we're only iterating addresses of
-         *     the sending interface
-         */
-
-        /* put all other addresses into the candidate set */
-        DEBUG("add to candidate set\n");
-        bf_set(candidate_set, i);
-        res = i;
-    }
-
-    return res;
-}
-
 ipv6_addr_t *gnrc_ipv6_netif_match_prefix(kernel_pid_t pid, const ipv6_addr_t *prefix)
 {
     ipv6_addr_t *res = NULL;
@@ -646,140 +584,218 @@ static uint8_t _get_scope(const ipv6_addr_t *addr, const bool maybe_multicast)
     }
 }
 
-/** @brief Find the best candidate among the configured addresses
- *          for a certain destination address according to the 8 rules
- *          specified in RFC 6734, section 5.
- * @see <a href="http://tools.ietf.org/html/rfc6724#section-5">
- *      RFC6724, section 5
+/**
+ * @brief   Checks if an address is a source address candidate
+ * @see <a href="http://tools.ietf.org/html/rfc6724#section-4">
+ *      RFC6724, section 4
  *      </a>
  *
- * @param[in] iface              The interface for sending.
- * @param[in] dst                The destination IPv6 address.
- * @param[in, out] candidate_set The preselected set of candidate addresses as
- *                               a bitfield.
- *
- * @pre @p dst is not unspecified.
- *
- * @return The best matching candidate found on @p iface, may be NULL if none
- *         is found.
+ * Currently this implementation supports only addresses assigned to the
+ * sending interface as candidates, so the ones for link-local and site-local
+ * destinations are also on the same link or site.
  */
-static ipv6_addr_t *_source_address_selection(gnrc_ipv6_netif_t *iface, const ipv6_addr_t *dst,
-                                              uint8_t *candidate_set)
+static inline bool _is_src_candidate(const gnrc_ipv6_netif_addr_t *addr,
+                                     bool link_local_only)
 {
-    /* create temporary set for assigning "points" to candidates wining in the
-     * corresponding rules.
+    /* "In any case, multicast addresses and the unspecified address MUST NOT
+     *  be included in a candidate set."
      */
-    uint8_t winner_set[GNRC_IPV6_NETIF_ADDR_NUMOF];
-    memset(winner_set, 0, GNRC_IPV6_NETIF_ADDR_NUMOF);
-
-    uint8_t max_pts = 0;
+    return !ipv6_addr_is_multicast(&addr->addr) &&
+           !ipv6_addr_is_unspecified(&addr->addr) &&
+           (!link_local_only || ipv6_addr_is_link_local(&addr->addr));
+}
 
-    /* _create_candidate_set() assures that `dest` is not unspecified and if
-     * `dst` is loopback rule 1 will fire anyway.  */
-    uint8_t dst_scope = _get_scope(dst, true);
-    DEBUG("finding the best match within the source address candidates\n");
+/**
+ * @brief   Length of the common prefix of two addresses
+ *
+ * Same as ipv6_addr_match_prefix(), but compares a word at a time.
+ */
+static uint8_t _match_prefix(const ipv6_addr_t *a, const ipv6_addr_t *b)
+{
+    for (unsigned i = 0; i < 4; i++) {
+        uint32_t diff = byteorder_ntohl(a->u32[i]) ^ byteorder_ntohl(b->u32[i]);
 
-    for (int i = 0; i < GNRC_IPV6_NETIF_ADDR_NUMOF; i++) {
-        gnrc_ipv6_netif_addr_t *iter = &(iface->addrs[i]);
-        DEBUG("Checking address: %s\n",
-              ipv6_addr_to_str(addr_str, &(iter->addr), sizeof(addr_str)));
-        /* entries which are not  part of the candidate set can be ignored */
-        if (!(bf_isset(candidate_set, i))) {
-            DEBUG("Not part of the candidate set - skipping\n");
-            continue;
+        if (diff != 0) {
+            /* unsigned long has at least, but not necessarily exactly 32 bit */
+            return (i * 32) + __builtin_clzl(diff) -
+                   ((sizeof(unsigned long) - sizeof(uint32_t)) * 8);
         }
+    }
+    return 128;
+}
 
-        /* Rule 1: if we have an address configured that equals the destination
-         * use this one as source */
-        if (ipv6_addr_equal(&(iter->addr), dst)) {
-            DEBUG("Ease one - rule 1\n");
-            return &(iter->addr);
-        }
+/* The candidates are link-local, site-local or global, so rule 2 can't tell
+ * apart the destination scopes in between those and they share a class */
+static const uint8_t _src_scope_class[] = {
+    0, 0,                           /* below link-local */
+    1,                              /* link-local */
+    2, 2,                           /* between link-local and site-local */
+    3,                              /* site-local */
+    4, 4, 4, 4, 4, 4, 4, 4,         /* between site-local and global */
+    5,                              /* global */
+    6,                              /* above global */
+};
 
-        /* Rule 2: Prefer appropriate scope. */
-        /* both link local */
-        uint8_t candidate_scope = _get_scope(&(iter->addr), false);
-        if (candidate_scope == dst_scope) {
-            DEBUG("winner for rule 2 (same scope) found\n");
-            winner_set[i] += RULE_2A_PTS;
-            if (winner_set[i] > max_pts) {
-                max_pts = RULE_2A_PTS;
-            }
-        }
-        else if (candidate_scope < dst_scope) {
-            DEBUG("winner for rule 2 (smaller scope) found\n");
-            winner_set[i] += RULE_2B_PTS;
-            if (winner_set[i] > max_pts) {
-                max_pts = winner_set[i];
-            }
-        }
+/* a destination scope of each class */
+static const uint8_t _src_class_scope[] = { 0, 2, 3, 5, 6, 14, 15 };
 
-        /* Rule 3: Avoid deprecated addresses. */
-        if (iter->preferred > 0) {
-            DEBUG("winner for rule 3 found\n");
-            winner_set[i] += RULE_3_PTS;
-            if (winner_set[i] > max_pts) {
-                max_pts = winner_set[i];
-            }
-        }
+#define SRC_SCOPE_CLASSES   (sizeof(_src_class_scope))
 
-        /* Rule 4: Prefer home addresses.
-         * Does not apply, gnrc does not support Mobile IP.
-         * TODO: update as soon as gnrc supports Mobile IP
-         */
+/**
+ * @brief   Precomputed rules 1 to 3 for a class of destination scopes
+ */
+typedef struct {
+    BITFIELD(same_scope, GNRC_IPV6_NETIF_ADDR_NUMOF);   /**< candidates that
+                                                         *   may equal the
+                                                         *   destination */
+    BITFIELD(winners, GNRC_IPV6_NETIF_ADDR_NUMOF);      /**< addresses with the
+                                                         *   most points */
+} _src_class_t;
 
-        /* Rule 5: Prefer outgoing interface.
-         * RFC 6724 says:
-         * "It is RECOMMENDED that the candidate source addresses be the set of
-         *  unicast addresses assigned to the interface that will be used to
-         *  send to the destination (the "outgoing" interface).  On routers,
-         *  the candidate set MAY include unicast addresses assigned to any
-         *  interface that forwards packets, subject to the restrictions
-         *  described below."
-         *  Currently this implementation uses ALWAYS source addresses assigned
-         *  to the outgoing interface. Hence, Rule 5 is always fulfilled.
-         */
+/**
+ * @brief   Source address selection table of an interface
+ */
+typedef struct {
+    _src_class_t classes[2][SRC_SCOPE_CLASSES]; /**< by link-local only and
+                                                 *   destination scope class */
+    uint8_t fallback[2];    /**< last candidate + 1, 0 if there is none */
+    unsigned generation;    /**< gnrc_ipv6_netif_generation the table was
+                             *   built in */
+} _src_table_t;
+
+/* gnrc_ipv6_netif_generation starts at 0 with no addresses, which an all 0
+ * table is correct for */
+static _src_table_t _src_tables[GNRC_NETIF_NUMOF];
 
-        /* Rule 6: Prefer matching label.
-         * Flow labels are currently not supported by gnrc.
-         * TODO: update as soon as gnrc supports flow labels
-         */
+/**
+ * @brief   Assigns the points of RFC 6724, section 5 to the addresses of an
+ *          interface for every class of destination scopes
+ * @see <a href="http://tools.ietf.org/html/rfc6724#section-5">
+ *      RFC6724, section 5
+ *      </a>
+ *
+ * Only rule 8 (longest matching prefix) depends on more than the scope of the
+ * destination, so it is left to gnrc_ipv6_netif_find_best_src_addr().
+ *
+ * @pre the interface's mutex is locked
+ */
+static void _build_src_table(gnrc_ipv6_netif_t *iface, _src_table_t *table)
+{
+    unsigned generation = gnrc_ipv6_netif_generation;
 
-        /* Rule 7: Prefer temporary addresses.
-         * Temporary addresses are currently not supported by gnrc.
-         * TODO: update as soon as gnrc supports temporary addresses
-         */
-    }
+    DEBUG("ipv6 netif: building source address table of interface %"
+          PRIkernel_pid "\n", iface->pid);
+    memset(table, 0, sizeof(_src_table_t));
 
-    /* reset candidate set to mark winners */
-    memset(candidate_set, 0, (GNRC_IPV6_NETIF_ADDR_NUMOF + 7) / 8);
-    /* check if we have a clear winner */
-    /* collect candidates with maximum points */
-    for (int i = 0; i < GNRC_IPV6_NETIF_ADDR_NUMOF; i++) {
-        if (winner_set[i] == max_pts) {
-            bf_set(candidate_set, i);
+    for (unsigned ll_only = 0; ll_only < 2; ll_only++) {
+        for (unsigned c = 0; c < SRC_SCOPE_CLASSES; c++) {
+            _src_class_t *cls = &table->classes[ll_only][c];
+            uint8_t points[GNRC_IPV6_NETIF_ADDR_NUMOF];
+            uint8_t max_pts = 0;
+
+            for (int i = 0; i < GNRC_IPV6_NETIF_ADDR_NUMOF; i++) {
+                gnrc_ipv6_netif_addr_t *iter = &(iface->addrs[i]);
+
+                points[i] = 0;
+                if (!_is_src_candidate(iter, ll_only)) {
+                    continue;
+                }
+                table->fallback[ll_only] = i + 1;
+
+                /* Rule 2: Prefer appropriate scope. */
+                uint8_t candidate_scope = _get_scope(&(iter->addr), false);
+                if (candidate_scope == _src_class_scope[c]) {
+                    /* Rule 1 can only apply to these */
+                    bf_set(cls->same_scope, i);
+                    points[i] += RULE_2A_PTS;
+                }
+                else if (candidate_scope < _src_class_scope[c]) {
+                    points[i] += RULE_2B_PTS;
+                }
+
+                /* Rule 3: Avoid deprecated addresses. */
+                if (iter->preferred > 0) {
+                    points[i] += RULE_3_PTS;
+                }
+
+                /* Rule 4: Prefer home addresses.
+                 * Does not apply, gnrc does not support Mobile IP.
+                 * TODO: update as soon as gnrc supports Mobile IP
+                 */
+
+                /* Rule 5: Prefer outgoing interface.
+                 * Currently this implementation uses ALWAYS source addresses
+                 * assigned to the outgoing interface. Hence, Rule 5 is always
+                 * fulfilled.
+                 */
+
+                /* Rule 6: Prefer matching label.
+                 * Flow labels are currently not supported by gnrc.
+                 * TODO: update as soon as gnrc supports flow labels
+                 */
+
+                /* Rule 7: Prefer temporary addresses.
+                 * Temporary addresses are currently not supported by gnrc.
+                 * TODO: update as soon as gnrc supports temporary addresses
+                 */
+                if (points[i] > max_pts) {
+                    max_pts = points[i];
+                }
+            }
+
+            /* collect addresses with maximum points, if no candidate got any
+             * points, this includes the addresses that are no candidate */
+            for (int i = 0; i < GNRC_IPV6_NETIF_ADDR_NUMOF; i++) {
+                gnrc_ipv6_netif_addr_t *iter = &(iface->addrs[i]);
+
+                if ((points[i] == max_pts) &&
+                    !gnrc_ipv6_netif_addr_is_non_unicast(&(iter->addr)) &&
+                    !ipv6_addr_is_unspecified(&(iter->addr))) {
+                    bf_set(cls->winners, i);
+                }
+            }
         }
     }
-
-    /* otherwise apply rule 8: Use longest matching prefix. */
-    ipv6_addr_t *res = NULL;
-    _find_by_prefix_unsafe(&res, iface, dst, candidate_set);
-    return res;
+    table->generation = generation;
 }
 
 ipv6_addr_t *gnrc_ipv6_netif_find_best_src_addr(kernel_pid_t pid, const ipv6_addr_t *dst, bool ll_only)
 {
     gnrc_ipv6_netif_t *iface = gnrc_ipv6_netif_get(pid);
+    _src_table_t *table = &_src_tables[iface - ipv6_ifs];
     ipv6_addr_t *best_src = NULL;
+
     mutex_lock(&(iface->mutex));
-    BITFIELD(candidate_set, GNRC_IPV6_NETIF_ADDR_NUMOF);
-    memset(candidate_set, 0, sizeof(candidate_set));
+    if (table->generation != gnrc_ipv6_netif_generation) {
+        _build_src_table(iface, table);
+    }
+
+    if (table->fallback[ll_only] > 0) {
+        _src_class_t *cls = &table->classes[ll_only][_src_scope_class[_get_scope(dst, true)]];
+        uint8_t best_match = 0;
+
+        for (int i = 0; i < GNRC_IPV6_NETIF_ADDR_NUMOF; i++) {
+            ipv6_addr_t *addr = &(iface->addrs[i].addr);
 
-    int first_candidate = _create_candidate_set(iface, dst, candidate_set, ll_only);
-    if (first_candidate >= 0) {
-        best_src = _source_address_selection(iface, dst, candidate_set);
+            /* Rule 1: if we have an address configured that equals the
+             * destination use this one as source */
+            if (bf_isset(cls->same_scope, i) && ipv6_addr_equal(addr, dst)) {
+                best_src = addr;
+                break;
+            }
+
+            /* Rule 8: Use longest matching prefix. */
+            if (bf_isset(cls->winners, i)) {
+                uint8_t match = _match_prefix(addr, dst);
+
+                if (match > best_match) {
+                    best_src = addr;
+                    best_match = match;
+                }
+            }
+        }
         if (best_src == NULL) {
-            best_src = &(iface->addrs[first_candidate].addr);
+            best_src = &(iface->addrs[table->fallback[ll_only] - 1].addr);
         }
     }
     mutex_unlock(&(iface->mutex));
@@ -881,6 +897,7 @@ void gnrc_ipv6_netif_init_by_dev(void)
         else {
             ipv6_if->flags &= ~GNRC_IPV6_NETIF_FLAGS_IS_WIRED;
         }
+        gnrc_ipv6_netif_changed();
 
         mutex_unlock(&ipv6_if->mutex);
 #if (defined(MODULE_GNRC_NDP_ROUTER) || defined(MODULE_GNRC_SIXLOWPAN_ND_ROUTER))
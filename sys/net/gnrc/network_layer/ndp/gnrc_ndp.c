@@ -345,6 +345,7 @@ void gnrc_ndp_nbr_adv_handle(kernel_pid_t iface, gnrc_pktsnip_t *pkt,
                     nc_entry->flags &= ~GNRC_IPV6_NC_IS_ROUTER;
                     /* TODO: update state of neighbor as router in FIB? */
                 }
+                gnrc_ipv6_nc_changed();
             }
             else if (l2tgt_changed &&
                      gnrc_ipv6_nc_get_state(nc_entry) == GNRC_IPV6_NC_STATE_REACHABLE) {
@@ -455,6 +456,7 @@ void gnrc_ndp_rtr_sol_handle(kernel_pid_t iface, gnrc_pktsnip_t *pkt,
             /* unset isRouter flag
              * (https://tools.ietf.org/html/rfc4861#section-6.2.6) */
             nc_entry->flags &= ~GNRC_IPV6_NC_IS_ROUTER;
+            gnrc_ipv6_nc_changed();
         }
     }
     /* otherwise ignore silently */
@@ -506,9 +508,11 @@ void gnrc_ndp_rtr_adv_handle(kernel_pid_t iface, gnrc_pktsnip_t *pkt, ipv6_hdr_t
     }
     else if ((nc_entry->flags & GNRC_IPV6_NC_IS_ROUTER) && (byteorder_ntohs(rtr_adv->ltime) == 0)) {
         nc_entry->flags &= ~GNRC_IPV6_NC_IS_ROUTER;
+        gnrc_ipv6_nc_changed();
     }
-    else {
+    else if (!(nc_entry->flags & GNRC_IPV6_NC_IS_ROUTER)) {
         nc_entry->flags |= GNRC_IPV6_NC_IS_ROUTER;
+        gnrc_ipv6_nc_changed();
     }
     /* set router life timer */
     if (rtr_adv->ltime.u16 != 0) {
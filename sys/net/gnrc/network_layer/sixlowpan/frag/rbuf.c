@@ -29,22 +29,18 @@
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
-/* estimated fragment payload size to determinate RBUF_INT_SIZE, default to
- * MAC payload size - fragment header. */
-#ifndef GNRC_SIXLOWPAN_FRAG_SIZE
-/* assuming 64-bit source/destination address, source PAN ID omitted */
-#define GNRC_SIXLOWPAN_FRAG_SIZE (104 - 5)
+#if RBUF_SIZE > 255
+#error "GNRC_SIXLOWPAN_FRAG_RBUF_SIZE must be at most 255"
 #endif
 
-#ifndef RBUF_INT_SIZE
-/* same as ((int) ceil((double) N / D)) */
-#define DIV_CEIL(N, D) (((N) + (D) - 1) / (D))
-#define RBUF_INT_SIZE (DIV_CEIL(GNRC_IPV6_NETIF_DEFAULT_MTU, GNRC_SIXLOWPAN_FRAG_SIZE) * RBUF_SIZE)
-#endif
+static rbuf_t rbuf[RBUF_SIZE];
 
-static rbuf_int_t rbuf_int[RBUF_INT_SIZE];
+/* entries are looked up by a hash of their source address and tag, the
+ * buckets link to their first entry by index + 1 */
+static uint8_t _buckets[RBUF_SIZE];
 
-static rbuf_t rbuf[RBUF_SIZE];
+static xtimer_t _gc_timer;
+static msg_t _gc_msg = { .type = GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF };
 
 #if ENABLE_DEBUG
 static char l2addr_str[3 * RBUF_L2ADDR_MAX_LEN];
@@ -53,16 +49,17 @@ static char l2addr_str[3 * RBUF_L2ADDR_MAX_LEN];
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
-/* checks whether start and end overlaps, but not identical to, given interval i */
-static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, uint16_t end);
-/* gets a free entry from interval buffer */
-static rbuf_int_t *_rbuf_int_get_free(void);
+/* gets the hash bucket of an entry */
+static inline uint8_t *_rbuf_bucket(const uint8_t *src, size_t src_len, uint16_t tag);
 /* remove entry from reassembly buffer */
 static void _rbuf_rem(rbuf_t *entry);
-/* update interval buffer of entry */
-static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size);
-/* checks timeouts and removes entries if necessary (oldest if full) */
-static void _rbuf_gc(void);
+/* removes entry if it timed out, returns true if it was removed */
+static bool _rbuf_expire(rbuf_t *entry, uint32_t now_usec);
+/* marks the units of a fragment as received, returns 1 if the fragment is
+ * new, 0 if all of its units were received before and -1 if only some were */
+static int _rbuf_update_received(rbuf_t *entry, uint16_t offset, size_t frag_size);
+/* schedules the next garbage collection, if there are entries */
+static void _rbuf_gc_schedule(uint32_t now_usec);
 /* gets an entry identified by its tupel */
 static rbuf_t *_rbuf_get(const void *src, size_t src_len,
                          const void *dst, size_t dst_len,
@@ -77,10 +74,8 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     unsigned int data_offset = 0;
     size_t original_size = frag_size;
     sixlowpan_frag_t *frag = pkt->data;
-    rbuf_int_t *ptr;
     uint8_t *data = ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
 
-    _rbuf_gc();
     entry = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
                       gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
                       byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK,
@@ -91,8 +86,6 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return;
     }
 
-    ptr = entry->ints;
-
     /* dispatches in the first fragment are ignored */
     if (offset == 0) {
         if (data[0] == SIXLOWPAN_UNCOMP) {
@@ -130,11 +123,24 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return;
     }
 
-    /* If the fragment overlaps another fragment and differs in either the size
-     * or the offset of the overlapped fragment, discards the datagram
-     * https://tools.ietf.org/html/rfc4944#section-5.3 */
-    while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
+    /* Only the received 8 octet units are known, not the fragments they came
+     * in. So this is more lenient than
+     * https://tools.ietf.org/html/rfc4944#section-5.3, which discards the
+     * datagram if a fragment overlaps another one with a different offset or
+     * size: a fragment is only taken as overlapping if some but not all of
+     * its units were received, and one that covers only received units is
+     * ignored as a duplicate, whatever fragments those units came in. */
+    switch (_rbuf_update_received(entry, offset, frag_size)) {
+        case 1:
+            DEBUG("6lo rbuf: add fragment data\n");
+            entry->cur_size += (uint16_t)frag_size;
+            memcpy(((uint8_t *)entry->pkt->data) + offset + data_offset, data,
+                   frag_size - data_offset);
+            break;
+        case 0:
+            DEBUG("6lo rfrag: duplicate fragment, ignoring\n");
+            break;
+        default:
             DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
             gnrc_pktbuf_release(entry->pkt);
             _rbuf_rem(entry);
@@ -145,16 +151,6 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
             rbuf_add(netif_hdr, pkt, original_size, offset);
 
             return;
-        }
-
-        ptr = ptr->next;
-    }
-
-    if (_rbuf_update_ints(entry, offset, frag_size)) {
-        DEBUG("6lo rbuf: add fragment data\n");
-        entry->cur_size += (uint16_t)frag_size;
-        memcpy(((uint8_t *)entry->pkt->data) + offset + data_offset, data,
-               frag_size - data_offset);
     }
 
     if (entry->cur_size == entry->pkt->size) {
@@ -189,85 +185,111 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     }
 }
 
-static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, uint16_t end)
+static inline uint8_t *_rbuf_bucket(const uint8_t *src, size_t src_len, uint16_t tag)
 {
-    /* start and ends are both inclusive, so using <= for both */
-    return ((i->start <= end) && (start <= i->end)) && /* overlaps */
-        ((start != i->start) || (end != i->end)); /* not identical */
-}
+    uint32_t hash = tag;
 
-static rbuf_int_t *_rbuf_int_get_free(void)
-{
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
-        }
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 33) + src[i];
     }
-
-    return NULL;
+    /* multiplicative hashing, the upper bits are mixed best */
+    hash = (hash * 0x9e3779b1UL) >> 16;
+    return &_buckets[hash % RBUF_SIZE];
 }
 
 static void _rbuf_rem(rbuf_t *entry)
 {
-    while (entry->ints != NULL) {
-        rbuf_int_t *next = entry->ints->next;
+    uint8_t i = (entry - rbuf) + 1;
 
-        entry->ints->start = 0;
-        entry->ints->end = 0;
-        entry->ints->next = NULL;
-        entry->ints = next;
+    for (uint8_t *next = _rbuf_bucket(entry->src, entry->src_len, entry->tag);
+         *next != 0; next = &rbuf[*next - 1].next) {
+        if (*next == i) {
+            *next = entry->next;
+            break;
+        }
     }
-
+    entry->next = 0;
     entry->pkt = NULL;
 }
 
-static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size)
+static bool _rbuf_expire(rbuf_t *entry, uint32_t now_usec)
 {
-    rbuf_int_t *new;
-    uint16_t end = (uint16_t)(offset + frag_size - 1);
-
-    new = _rbuf_int_get_free();
-
-    if (new == NULL) {
-        DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
+    if ((entry->pkt == NULL) || ((now_usec - entry->arrival) <= RBUF_TIMEOUT)) {
         return false;
     }
+    DEBUG("6lo rfrag: entry (%s, ", gnrc_netif_addr_to_str(l2addr_str,
+            sizeof(l2addr_str), entry->src, entry->src_len));
+    DEBUG("%s, %u, %u) timed out\n",
+          gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), entry->dst,
+                                 entry->dst_len),
+          (unsigned)entry->pkt->size, entry->tag);
+
+    gnrc_pktbuf_release(entry->pkt);
+    _rbuf_rem(entry);
+    return true;
+}
+
+static int _rbuf_update_received(rbuf_t *entry, uint16_t offset, size_t frag_size)
+{
+    unsigned first = offset / 8U, last, received = 0;
 
-    new->start = offset;
-    new->end = end;
+    if (frag_size == 0) {
+        return 0;
+    }
+    last = (offset + frag_size - 1) / 8U;
+    for (unsigned i = first; i <= last; i++) {
+        if (bf_isset(entry->received, i)) {
+            received++;
+        }
+    }
+    if (received > 0) {
+        return (received == (last - first + 1)) ? 0 : -1;
+    }
+    for (unsigned i = first; i <= last; i++) {
+        bf_set(entry->received, i);
+    }
 
-    DEBUG("6lo rfrag: add interval (%" PRIu16 ", %" PRIu16 ") to entry (%s, ",
-          new->start, new->end, gnrc_netif_addr_to_str(l2addr_str,
-                  sizeof(l2addr_str), entry->src, entry->src_len));
+    DEBUG("6lo rfrag: add units (%u, %u) to entry (%s, ", first, last,
+          gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), entry->src,
+                                 entry->src_len));
     DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(l2addr_str,
             sizeof(l2addr_str), entry->dst, entry->dst_len),
           (unsigned)entry->pkt->size, entry->tag);
+    return 1;
+}
 
-    LL_PREPEND(entry->ints, new);
+/* (re)sets the garbage collection timer to the next timeout, xtimer_set_msg()
+ * replaces a pending one. This also recovers from a lost timer message (e.g.
+ * when the 6LoWPAN message queue was full) with the next new entry. */
+static void _rbuf_gc_schedule(uint32_t now_usec)
+{
+    uint32_t next = RBUF_TIMEOUT;
+    bool pending = false;
 
-    return true;
+    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
+        if (rbuf[i].pkt != NULL) {
+            uint32_t left = RBUF_TIMEOUT - (now_usec - rbuf[i].arrival);
+
+            if (left < next) {
+                next = left;
+            }
+            pending = true;
+        }
+    }
+    if (pending) {
+        /* entries time out once they are older than RBUF_TIMEOUT */
+        xtimer_set_msg(&_gc_timer, next + 1, &_gc_msg, thread_getpid());
+    }
 }
 
-static void _rbuf_gc(void)
+void rbuf_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
-    unsigned int i;
-
-    for (i = 0; i < RBUF_SIZE; i++) {
-        /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if ((rbuf[i].pkt != NULL) &&
-              ((now_usec - rbuf[i].arrival) > RBUF_TIMEOUT)) {
-            DEBUG("6lo rfrag: entry (%s, ", gnrc_netif_addr_to_str(l2addr_str,
-                    sizeof(l2addr_str), rbuf[i].src, rbuf[i].src_len));
-            DEBUG("%s, %u, %u) timed out\n",
-                  gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), rbuf[i].dst,
-                                         rbuf[i].dst_len),
-                  (unsigned)rbuf[i].pkt->size, rbuf[i].tag);
-
-            gnrc_pktbuf_release(rbuf[i].pkt);
-            _rbuf_rem(&(rbuf[i]));
-        }
+
+    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
+        _rbuf_expire(&rbuf[i], now_usec);
     }
+    _rbuf_gc_schedule(now_usec);
 }
 
 static rbuf_t *_rbuf_get(const void *src, size_t src_len,
@@ -276,33 +298,48 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
 {
     rbuf_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
-
-    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].pkt->size == size) &&
-            (rbuf[i].tag == tag) && (rbuf[i].src_len == src_len) &&
-            (rbuf[i].dst_len == dst_len) &&
-            (memcmp(rbuf[i].src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
+    uint8_t *bucket = _rbuf_bucket(src, src_len, tag);
+
+    /* check first if entry already available */
+    for (uint8_t i = *bucket; i != 0; i = rbuf[i - 1].next) {
+        rbuf_t *entry = &rbuf[i - 1];
+
+        if ((entry->pkt->size == size) && (entry->tag == tag) &&
+            (entry->src_len == src_len) && (entry->dst_len == dst_len) &&
+            (memcmp(entry->src, src, src_len) == 0) &&
+            (memcmp(entry->dst, dst, dst_len) == 0)) {
+            /* the garbage collection may not have run yet */
+            if (_rbuf_expire(entry, now_usec)) {
+                break;
+            }
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)entry,
                   gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str),
-                                         rbuf[i].src, rbuf[i].src_len));
+                                         entry->src, entry->src_len));
             DEBUG("%s, %u, %u) found\n",
                   gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str),
-                                         rbuf[i].dst, rbuf[i].dst_len),
-                  (unsigned)rbuf[i].pkt->size, rbuf[i].tag);
-            rbuf[i].arrival = now_usec;
-            return &(rbuf[i]);
+                                         entry->dst, entry->dst_len),
+                  (unsigned)entry->pkt->size, entry->tag);
+            entry->arrival = now_usec;
+            return entry;
         }
+    }
+
+    /* only a new datagram needs a pass over all entries */
+    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
+        /* since pkt occupies pktbuf, aggressivly collect garbage, in case a
+         * garbage collection message got lost */
+        _rbuf_expire(&rbuf[i], now_usec);
 
         /* if there is a free spot: remember it */
-        if ((res == NULL) && (rbuf[i].pkt == NULL)) {
-            res = &(rbuf[i]);
+        if (rbuf[i].pkt == NULL) {
+            if (res == NULL) {
+                res = &(rbuf[i]);
+            }
         }
-
         /* remember oldest slot */
         /* note that xtimer_now will overflow in ~1.2 hours */
-        if ((oldest == NULL) || (oldest->arrival - rbuf[i].arrival < UINT32_MAX / 2)) {
+        else if ((oldest == NULL) ||
+                 (oldest->arrival - rbuf[i].arrival < UINT32_MAX / 2)) {
             oldest = &(rbuf[i]);
         }
     }
@@ -310,7 +347,6 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
     /* entry not in buffer and no empty spot found */
     if (res == NULL) {
         assert(oldest != NULL);
-        assert(oldest->pkt != NULL); /* if oldest->pkt == NULL, res must not be NULL */
         DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
         gnrc_pktbuf_release(oldest->pkt);
         _rbuf_rem(oldest);
@@ -327,6 +363,7 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
 
     *((uint64_t *)res->pkt->data) = 0;  /* clean first few bytes for later
                                          * look-ups */
+    memset(res->received, 0, sizeof(res->received));
     res->arrival = now_usec;
     memcpy(res->src, src, src_len);
     memcpy(res->dst, dst, dst_len);
@@ -334,6 +371,8 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
     res->dst_len = dst_len;
     res->tag = tag;
     res->cur_size = 0;
+    res->next = *bucket;
+    *bucket = (res - rbuf) + 1;
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), res->src,
@@ -343,6 +382,8 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
                                  res->dst_len), (unsigned)res->pkt->size,
           res->tag);
 
+    _rbuf_gc_schedule(now_usec);
+
     return res;
 }
 
@@ -21,6 +21,7 @@
 
 #include <inttypes.h>
 
+#include "bitfield.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
 
@@ -31,26 +32,20 @@ extern "C" {
 #endif
 
 #define RBUF_L2ADDR_MAX_LEN (8U)               /**< maximum length for link-layer addresses */
-#define RBUF_SIZE           (4U)               /**< size of the reassembly buffer */
+#define RBUF_SIZE           (GNRC_SIXLOWPAN_FRAG_RBUF_SIZE) /**< size of the reassembly buffer */
 #define RBUF_TIMEOUT        (3U * US_PER_SEC) /**< timeout for reassembly in microseconds */
 
 /**
- * @brief   Fragment intervals to identify limits of fragments.
+ * @brief   Number of 8 octet units of the largest datagram
  *
- * @note    Fragments MUST NOT overlap and overlapping fragments are to be
- *          discarded
+ * Fragment offsets are given in 8 octet units, so every fragment but the
+ * last one covers complete units.
  *
  * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
  *          RFC 4944, section 5.3
  *      </a>
- *
- * @internal
  */
-typedef struct rbuf_int {
-    struct rbuf_int *next;  /**< next element in interval list */
-    uint16_t start;         /**< start byte of interval */
-    uint16_t end;           /**< end byte of interval */
-} rbuf_int_t;
+#define RBUF_UNITS          ((SIXLOWPAN_FRAG_MAX_LEN + 7U) / 8U)
 
 /**
  * @brief   An entry in the 6LoWPAN reassembly buffer.
@@ -71,7 +66,8 @@ typedef struct rbuf_int {
  * @internal
  */
 typedef struct {
-    rbuf_int_t *ints;                   /**< intervals of the fragment */
+    BITFIELD(received, RBUF_UNITS);     /**< 8 octet units of the datagram
+                                         *   that were received */
     gnrc_pktsnip_t *pkt;                /**< the reassembled packet in packet buffer */
     uint32_t arrival;                   /**< time in microseconds of arrival of
                                          *   last received fragment */
@@ -81,6 +77,8 @@ typedef struct {
     uint8_t dst_len;                    /**< length of destination address */
     uint16_t tag;                       /**< the datagram's tag */
     uint16_t cur_size;                  /**< the datagram's current size */
+    uint8_t next;                       /**< next entry in the same hash
+                                         *   bucket, index + 1 */
 } rbuf_t;
 
 /**
@@ -100,6 +98,16 @@ typedef struct {
 void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *frag,
               size_t frag_size, size_t offset);
 
+/**
+ * @brief   Removes the entries that timed out
+ *
+ * Called on @ref GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF, which rbuf_add() schedules
+ * to the calling thread while there are entries in the reassembly buffer.
+ *
+ * @internal
+ */
+void rbuf_gc(void);
+
 #ifdef __cplusplus
 }
 #endif
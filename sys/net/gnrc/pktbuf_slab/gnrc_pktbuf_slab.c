@@ -0,0 +1,696 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer implementation based on fixed-size slabs
+ *
+ * Every slab is a contiguous region of the packet buffer, holding blocks of
+ * equal size that are kept in a singly linked free list. Packet snip
+ * descriptors come from a dedicated slab, data from the smallest size class
+ * that fits. Since gnrc_pktbuf_mark() lets several snips point into the same
+ * data block, every data block carries a reference count and is only
+ * returned to its slab when the last snip pointing into it is released.
+ *
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "mutex.h"
+#include "utlist.h"
+#include "net/ethernet.h"
+#include "net/ieee802154.h"
+#include "net/ipv6.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define _ALIGNMENT_MASK     (sizeof(void *) - 1)
+#define _ALIGN(size)        (((size) + _ALIGNMENT_MASK) & ~(_ALIGNMENT_MASK))
+
+/**
+ * @brief   Block sizes of all slabs
+ * @{
+ */
+#define _SNIP_SIZE          _ALIGN(sizeof(gnrc_pktsnip_t))
+#define _SMALL_SIZE         _ALIGN(GNRC_PKTBUF_SLAB_SMALL_SIZE)
+#define _IEEE802154_SIZE    _ALIGN(IEEE802154_FRAME_LEN_MAX)
+#define _IPV6_SIZE          _ALIGN(IPV6_MIN_MTU)
+#define _ETHERNET_SIZE      _ALIGN(ETHERNET_FRAME_LEN)
+/** @} */
+
+#define _DATA_BLOCK_NUMOF   (GNRC_PKTBUF_SLAB_SMALL_NUMOF + \
+                             GNRC_PKTBUF_SLAB_IEEE802154_NUMOF + \
+                             GNRC_PKTBUF_SLAB_IPV6_NUMOF + \
+                             GNRC_PKTBUF_SLAB_ETHERNET_NUMOF)
+#define _ARENA_SIZE         ((_SNIP_SIZE * GNRC_PKTBUF_SLAB_SNIP_NUMOF) + \
+                             (_SMALL_SIZE * GNRC_PKTBUF_SLAB_SMALL_NUMOF) + \
+                             (_IEEE802154_SIZE * GNRC_PKTBUF_SLAB_IEEE802154_NUMOF) + \
+                             (_IPV6_SIZE * GNRC_PKTBUF_SLAB_IPV6_NUMOF) + \
+                             (_ETHERNET_SIZE * GNRC_PKTBUF_SLAB_ETHERNET_NUMOF))
+
+/**
+ * @brief   Slab indexes. Data slabs must be sorted by ascending block size.
+ */
+enum {
+    _SLAB_SNIP = 0,
+    _SLAB_SMALL,
+    _SLAB_IEEE802154,
+    _SLAB_IPV6,
+    _SLAB_ETHERNET,
+    _SLAB_NUMOF,
+};
+
+typedef struct _unused {
+    struct _unused *next;
+} _unused_t;
+
+typedef struct {
+    _unused_t *free;            /**< first free block */
+    uint8_t *start;             /**< first block of the slab */
+    uint16_t block_size;        /**< size of a block in byte */
+    uint16_t numof;             /**< number of blocks */
+    uint16_t used;              /**< number of blocks currently in use */
+    uint16_t ref_offset;        /**< offset of the slab's blocks in _refs */
+#ifdef DEVELHELP
+    uint16_t max_used;          /**< maximum number of blocks in use */
+#endif
+} _slab_t;
+
+static const uint16_t _block_sizes[_SLAB_NUMOF] = {
+    _SNIP_SIZE, _SMALL_SIZE, _IEEE802154_SIZE, _IPV6_SIZE, _ETHERNET_SIZE,
+};
+
+static const uint16_t _block_numofs[_SLAB_NUMOF] = {
+    GNRC_PKTBUF_SLAB_SNIP_NUMOF,
+    GNRC_PKTBUF_SLAB_SMALL_NUMOF,
+    GNRC_PKTBUF_SLAB_IEEE802154_NUMOF,
+    GNRC_PKTBUF_SLAB_IPV6_NUMOF,
+    GNRC_PKTBUF_SLAB_ETHERNET_NUMOF,
+};
+
+static mutex_t _mutex = MUTEX_INIT;
+static uint8_t _pktbuf[_ARENA_SIZE] __attribute__((aligned(sizeof(void *))));
+static uint8_t _refs[_DATA_BLOCK_NUMOF];
+static _slab_t _slabs[_SLAB_NUMOF];
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_slab_alloc(_slab_t *slab);
+static void _slab_free(_slab_t *slab, void *block);
+static void *_data_alloc(size_t size);
+static void _data_ref(void *data);
+static void _data_unref(void *data);
+
+static inline bool _slab_contains(const _slab_t *slab, const void *ptr)
+{
+    return (size_t)((uint8_t *)ptr - slab->start) <
+           ((size_t)slab->block_size * slab->numof);
+}
+
+static inline unsigned _slab_idx(const _slab_t *slab, const void *ptr)
+{
+    return (unsigned)((size_t)((uint8_t *)ptr - slab->start) / slab->block_size);
+}
+
+static inline bool _pktbuf_contains(const void *ptr)
+{
+    return (size_t)((uint8_t *)ptr - _pktbuf) < sizeof(_pktbuf);
+}
+
+/* returns the data slab containing ptr or NULL if ptr is not in a data slab */
+static _slab_t *_data_slab(const void *ptr)
+{
+    for (unsigned i = _SLAB_SNIP + 1; i < _SLAB_NUMOF; i++) {
+        if (_slab_contains(&_slabs[i], ptr)) {
+            return &_slabs[i];
+        }
+    }
+    return NULL;
+}
+
+static inline uint8_t *_ref(const void *data)
+{
+    _slab_t *slab = _data_slab(data);
+
+    assert(slab != NULL);
+    return &_refs[slab->ref_offset + _slab_idx(slab, data)];
+}
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    atomic_init(&pkt->users, 1);
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+void gnrc_pktbuf_init(void)
+{
+    uint8_t *start = _pktbuf;
+    uint16_t ref_offset = 0;
+
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        slab->free = NULL;
+        slab->start = start;
+        slab->block_size = _block_sizes[i];
+        slab->numof = _block_numofs[i];
+        slab->used = 0;
+        slab->ref_offset = ref_offset;
+#ifdef DEVELHELP
+        slab->max_used = 0;
+#endif
+        /* link blocks back to front so lower addresses get allocated first */
+        for (unsigned j = slab->numof; j > 0; j--) {
+            _unused_t *block = (_unused_t *)(start + ((j - 1) * slab->block_size));
+            block->next = slab->free;
+            slab->free = block;
+        }
+        start += (size_t)slab->block_size * slab->numof;
+        if (i != _SLAB_SNIP) {
+            ref_offset += slab->numof;
+        }
+    }
+    memset(_refs, 0, sizeof(_refs));
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _ETHERNET_SIZE) {
+        DEBUG("pktbuf: size (%u) > largest slab block size (%u)\n",
+              (unsigned)size, (unsigned)_ETHERNET_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add_rx(size_t size, size_t hdr_len)
+{
+    gnrc_pktsnip_t *pkt;
+    /* pad in front, so data after the header starts at an aligned address */
+    size_t pad = _ALIGN(hdr_len) - hdr_len;
+    uint8_t *data;
+
+    if ((size + pad) > _ETHERNET_SIZE) {
+        DEBUG("pktbuf: size (%u) > largest slab block size (%u)\n",
+              (unsigned)size, (unsigned)_ETHERNET_SIZE);
+        return NULL;
+    }
+    if (size == 0) {
+        return gnrc_pktbuf_add(NULL, NULL, 0, GNRC_NETTYPE_UNDEF);
+    }
+    mutex_lock(&_mutex);
+    pkt = _slab_alloc(&_slabs[_SLAB_SNIP]);
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    data = _data_alloc(pad + size);
+    if (data == NULL) {
+        DEBUG("pktbuf: error allocating data for new packet snip\n");
+        _slab_free(&_slabs[_SLAB_SNIP], pkt);
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    _set_pktsnip(pkt, NULL, data + pad, size, GNRC_NETTYPE_UNDEF);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _slab_alloc(&_slabs[_SLAB_SNIP]);
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    _set_pktsnip(marked_snip, pkt->next, pkt->data, size, type);
+    if (pkt->size == size) {
+        pkt->data = NULL;
+    }
+    /* remaining data would be unaligned for the header structs it is cast to
+     * (e.g. after a 6LoWPAN dispatch) => move it to a block of its own */
+    else if ((((uintptr_t)pkt->data) + size) & _ALIGNMENT_MASK) {
+        void *new_data_rest = _data_alloc(pkt->size - size);
+
+        if (new_data_rest == NULL) {
+            DEBUG("pktbuf: could not reallocate remaining section.\n");
+            _slab_free(&_slabs[_SLAB_SNIP], marked_snip);
+            mutex_unlock(&_mutex);
+            return NULL;
+        }
+        memcpy(new_data_rest, ((uint8_t *)pkt->data) + size, pkt->size - size);
+        pkt->data = new_data_rest;
+    }
+    /* both snips now point into the same data block => no copy required */
+    else {
+        _data_ref(pkt->data);
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    pkt->size -= size;
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && _pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _data_unref(pkt->data);
+        pkt->data = NULL;
+    }
+    else if (size > pkt->size) {
+        _slab_t *slab = (pkt->data) ? _data_slab(pkt->data) : NULL;
+
+        /* grow in place if the block is not shared and there is room left in
+         * it, otherwise move to a block of a (possibly) larger size class */
+        if ((slab == NULL) || (*_ref(pkt->data) > 1) ||
+            ((((uint8_t *)pkt->data - slab->start) % slab->block_size) + size >
+             slab->block_size)) {
+            void *new_data = (size <= _ETHERNET_SIZE) ? _data_alloc(size) : NULL;
+
+            if (new_data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&_mutex);
+                return ENOMEM;
+            }
+            if (pkt->data != NULL) {        /* if old data exist */
+                memcpy(new_data, pkt->data, pkt->size);
+                _data_unref(pkt->data);
+            }
+            pkt->data = new_data;
+        }
+    }
+    /* if new size is smaller than old size, just keep the block */
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    while (pkt) {
+        atomic_fetch_add(&pkt->users, num);
+        pkt = pkt->next;
+    }
+}
+
+static inline void _free_snip_and_data(gnrc_pktsnip_t *pkt)
+{
+    if (pkt->data != NULL) {
+        _data_unref(pkt->data);
+    }
+    _slab_free(&_slabs[_SLAB_SNIP], pkt);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_slab_contains(&_slabs[_SLAB_SNIP], pkt));
+        tmp = pkt->next;
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        if (atomic_fetch_sub(&pkt->users, 1) == 1) {
+            _free_snip_and_data(pkt);
+        }
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_slab_contains(&_slabs[_SLAB_SNIP], pkt));
+        /* pkt may be freed by another user as soon as we dropped our
+         * reference, so read and report everything before */
+        tmp = pkt->next;
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        if (atomic_fetch_sub(&pkt->users, 1) == 1) {
+            mutex_lock(&_mutex);
+            _free_snip_and_data(pkt);
+            mutex_unlock(&_mutex);
+        }
+        pkt = tmp;
+    }
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    if ((pkt == NULL) || (pkt->size == 0)) {
+        return NULL;
+    }
+    if (atomic_load(&pkt->users) > 1) {
+        gnrc_pktsnip_t *new;
+        mutex_lock(&_mutex);
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        /* the other users might have released pkt in the meantime, so
+         * free it if we were the last one */
+        if ((new != NULL) && (atomic_fetch_sub(&pkt->users, 1) == 1)) {
+            /* pkt->next is now referenced by new */
+            _free_snip_and_data(pkt);
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_get_iovec(gnrc_pktsnip_t *pkt, size_t *len)
+{
+    size_t length;
+    gnrc_pktsnip_t *head;
+    struct iovec *vec;
+
+    assert(len != NULL);
+    if (pkt == NULL) {
+        *len = 0;
+        return NULL;
+    }
+
+    /* count the number of snips in the packet and allocate the IOVEC */
+    length = gnrc_pkt_count(pkt);
+    head = gnrc_pktbuf_add(pkt, NULL, (length * sizeof(struct iovec)),
+                           GNRC_NETTYPE_IOVEC);
+    if (head == NULL) {
+        *len = 0;
+        return NULL;
+    }
+
+    assert(head->data != NULL);
+    vec = (struct iovec *)(head->data);
+    /* fill the IOVEC */
+    while (pkt != NULL) {
+        vec->iov_base = pkt->data;
+        vec->iov_len = pkt->size;
+        ++vec;
+        pkt = pkt->next;
+    }
+    *len = length;
+    return head;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[_SLAB_NUMOF] = {
+        "snip", "small", "802.15.4", "ipv6", "ethernet"
+    };
+
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_pktbuf[0], (void *)&_pktbuf[sizeof(_pktbuf)],
+           (unsigned)sizeof(_pktbuf));
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        printf("  %-8s (block size: %4u): %3u / %3u used (max: %3u)\n",
+               names[i], (unsigned)slab->block_size, (unsigned)slab->used,
+               (unsigned)slab->numof, (unsigned)slab->max_used);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        if (_slabs[i].used > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall blocks in a free list: the block is in the slab of the list
+     *    and at a block boundary
+     *  - forall slabs: length of free list == slab->numof - slab->used
+     *  - forall data blocks in a free list: reference count == 0
+     */
+    for (unsigned i = 0; i < _SLAB_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+        unsigned free_numof = 0;
+
+        for (_unused_t *ptr = slab->free; ptr != NULL; ptr = ptr->next) {
+            if (!_slab_contains(slab, ptr) ||
+                ((((uint8_t *)ptr) - slab->start) % slab->block_size) != 0) {
+                return false;
+            }
+            if ((i != _SLAB_SNIP) &&
+                (_refs[slab->ref_offset + _slab_idx(slab, ptr)] != 0)) {
+                return false;
+            }
+            if (++free_numof > slab->numof) {
+                return false;
+            }
+        }
+        if (free_numof != (unsigned)(slab->numof - slab->used)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _slab_alloc(&_slabs[_SLAB_SNIP]);
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _data_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _slab_free(&_slabs[_SLAB_SNIP], pkt);
+            return NULL;
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    if ((data != NULL) && (size > 0)) {
+        memcpy(_data, data, size);
+    }
+    return pkt;
+}
+
+static void *_slab_alloc(_slab_t *slab)
+{
+    _unused_t *block = slab->free;
+
+    if (block == NULL) {
+        return NULL;
+    }
+    slab->free = block->next;
+    slab->used++;
+#ifdef DEVELHELP
+    if (slab->used > slab->max_used) {
+        slab->max_used = slab->used;
+    }
+#endif
+    return block;
+}
+
+static void _slab_free(_slab_t *slab, void *block)
+{
+    _unused_t *unused = block;
+
+    assert(_slab_contains(slab, block));
+    assert(slab->used > 0);
+    unused->next = slab->free;
+    slab->free = unused;
+    slab->used--;
+}
+
+static void *_data_alloc(size_t size)
+{
+    for (unsigned i = _SLAB_SNIP + 1; i < _SLAB_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        if (size <= slab->block_size) {
+            void *data = _slab_alloc(slab);
+
+            if (data != NULL) {
+                _refs[slab->ref_offset + _slab_idx(slab, data)] = 1;
+                return data;
+            }
+        }
+    }
+    DEBUG("pktbuf: no space left in packet buffer\n");
+    return NULL;
+}
+
+static void _data_ref(void *data)
+{
+    uint8_t *ref = _ref(data);
+
+    assert(*ref < UINT8_MAX);
+    (*ref)++;
+}
+
+static void _data_unref(void *data)
+{
+    _slab_t *slab = _data_slab(data);
+    unsigned idx;
+
+    assert(slab != NULL);
+    idx = _slab_idx(slab, data);
+    assert(_refs[slab->ref_offset + idx] > 0);
+    if (--_refs[slab->ref_offset + idx] == 0) {
+        _slab_free(slab, slab->start + (idx * slab->block_size));
+    }
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_remove_snip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *snip)
+{
+    LL_DELETE(pkt, snip);
+    snip->next = NULL;
+    gnrc_pktbuf_release(snip);
+
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_replace_snip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *old, gnrc_pktsnip_t *add)
+{
+    /* If add is a list we need to preserve its tail */
+    if (add->next != NULL) {
+        gnrc_pktsnip_t *tail = add->next;
+        gnrc_pktsnip_t *back;
+        LL_SEARCH_SCALAR(tail, back, next, NULL); /* find the last snip in add */
+        /* Replace old */
+        LL_REPLACE_ELEM(pkt, old, add);
+        /* and wire in the tail between */
+        back->next = add->next;
+        add->next = tail;
+    }
+    else {
+        /* add is a single element, has no tail, simply replace */
+        LL_REPLACE_ELEM(pkt, old, add);
+    }
+    old->next = NULL;
+    gnrc_pktbuf_release(old);
+
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
+{
+    mutex_lock(&_mutex);
+
+    bool is_shared = atomic_load(&pkt->users) > 1;
+    size_t size = gnrc_pkt_len_upto(pkt, type);
+
+    DEBUG("ipv6_ext: duplicating %d octets\n", (int) size);
+
+    gnrc_pktsnip_t *tmp;
+    gnrc_pktsnip_t *target = gnrc_pktsnip_search_type(pkt, type);
+    gnrc_pktsnip_t *next = (target == NULL) ? NULL : target->next;
+    gnrc_pktsnip_t *new = _create_snip(next, NULL, size, type);
+
+    if (new == NULL) {
+        mutex_unlock(&_mutex);
+
+        return NULL;
+    }
+
+    /* copy payloads */
+    for (tmp = pkt; tmp != NULL; tmp = tmp->next) {
+        uint8_t *dest = ((uint8_t *)new->data) + (size - tmp->size);
+
+        memcpy(dest, tmp->data, tmp->size);
+
+        size -= tmp->size;
+
+        if (tmp->type == type) {
+            break;
+        }
+    }
+
+    /* decrements reference counters */
+
+    if (target != NULL) {
+        target->next = NULL;
+    }
+
+    _release_error_locked(pkt, GNRC_NETERR_SUCCESS);
+
+    if (is_shared && (target != NULL)) {
+        target->next = next;
+    }
+
+    mutex_unlock(&_mutex);
+
+    return new;
+}
+
+/** @} */
@@ -24,8 +24,10 @@
 #include <sys/types.h>
 #include <sys/uio.h>
 
+#include "irq.h"
 #include "mutex.h"
 #include "od.h"
+#include "thread.h"
 #include "utlist.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/nettype.h"
@@ -45,16 +47,47 @@ static mutex_t _mutex = MUTEX_INIT;
 static uint8_t _pktbuf[GNRC_PKTBUF_SIZE];
 static _unused_t *_first_unused;
 
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+/* per-thread caches of free snip descriptors, linked by gnrc_pktsnip_t::next.
+ * A thread only takes from and adds to its own cache, so they are accessed
+ * with interrupts disabled instead of with _mutex held. A snip only goes back
+ * to the cache of the thread that allocated it, snips released by other
+ * threads are returned to the packet buffer. All caches are returned to the
+ * packet buffer when it runs out of space, so the snips of a thread that
+ * exited are not lost */
+static gnrc_pktsnip_t *_cache[KERNEL_PID_LAST + 1];
+static uint8_t _cache_numof[KERNEL_PID_LAST + 1];
+#endif
+
 #ifdef DEVELHELP
 /* maximum number of bytes allocated */
 static uint16_t max_byte_count = 0;
 #endif
 
 /* internal gnrc_pktbuf functions */
-static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, void *data, size_t size,
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                    void *data, size_t size,
                                     gnrc_nettype_t type);
 static void *_pktbuf_alloc(size_t size);
 static void _pktbuf_free(void *data, size_t size);
+static gnrc_pktsnip_t *_snip_alloc(void);
+static void _snip_free(gnrc_pktsnip_t *pkt);
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+static gnrc_pktsnip_t *_cache_get(void);
+static bool _cache_put(gnrc_pktsnip_t *pkt);
+static bool _cache_flush(void);
+#else
+static inline gnrc_pktsnip_t *_cache_get(void)
+{
+    return NULL;
+}
+
+static inline bool _cache_put(gnrc_pktsnip_t *pkt)
+{
+    (void)pkt;
+    return false;
+}
+#endif
 
 static inline bool _pktbuf_contains(void *ptr)
 {
@@ -67,6 +100,19 @@ static inline size_t _align(size_t size)
     return (size + _ALIGNMENT_MASK) & ~(_ALIGNMENT_MASK);
 }
 
+/* size of the chunk required for size bytes */
+static inline size_t _chunk_size(size_t size)
+{
+    return (size < sizeof(_unused_t)) ? _align(sizeof(_unused_t)) : _align(size);
+}
+
+/* offset of data to the start of its chunk: data of snips allocated with
+ * gnrc_pktbuf_add_rx() does not start at an aligned address */
+static inline size_t _offset(const void *data)
+{
+    return (size_t)((uint8_t *)data - _pktbuf) & _ALIGNMENT_MASK;
+}
+
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
 {
@@ -74,7 +120,7 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
     pkt->data = data;
     pkt->size = size;
     pkt->type = type;
-    pkt->users = 1;
+    atomic_init(&pkt->users, 1);
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
@@ -83,6 +129,12 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 void gnrc_pktbuf_init(void)
 {
     mutex_lock(&_mutex);
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+    unsigned state = irq_disable();
+    memset(_cache, 0, sizeof(_cache));
+    memset(_cache_numof, 0, sizeof(_cache_numof));
+    irq_restore(state);
+#endif
     _first_unused = (_unused_t *)_pktbuf;
     _first_unused->next = NULL;
     _first_unused->size = sizeof(_pktbuf);
@@ -99,8 +151,51 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, void *data, size_t size,
               (unsigned)size, GNRC_PKTBUF_SIZE);
         return NULL;
     }
+    pkt = _cache_get();
+    if ((pkt != NULL) && (size == 0)) {
+        /* no data to allocate => the lock is not needed */
+        _set_pktsnip(pkt, next, NULL, 0, type);
+        return pkt;
+    }
     mutex_lock(&_mutex);
-    pkt = _create_snip(next, data, size, type);
+    pkt = _create_snip(pkt, next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add_rx(size_t size, size_t hdr_len)
+{
+    gnrc_pktsnip_t *pkt;
+    /* pad in front, so data after the header starts at an aligned address */
+    size_t pad = _align(hdr_len) - hdr_len;
+    uint8_t *chunk;
+
+    if ((size + pad) > GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)size, GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    if (size == 0) {
+        return gnrc_pktbuf_add(NULL, NULL, 0, GNRC_NETTYPE_UNDEF);
+    }
+    pkt = _cache_get();
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        pkt = _snip_alloc();
+    }
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    chunk = _pktbuf_alloc(pad + size);
+    if (chunk == NULL) {
+        DEBUG("pktbuf: error allocating data for new packet snip\n");
+        _snip_free(pkt);
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    _set_pktsnip(pkt, NULL, chunk + pad, size, GNRC_NETTYPE_UNDEF);
     mutex_unlock(&_mutex);
     return pkt;
 }
@@ -109,21 +204,24 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
 {
     gnrc_pktsnip_t *marked_snip;
     /* size required for chunk */
-    size_t required_new_size = (size < sizeof(_unused_t)) ?
-                               _align(sizeof(_unused_t)) : _align(size);
+    size_t required_new_size;
     void *new_data_marked;
 
-    mutex_lock(&_mutex);
     if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
         DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
               "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
               (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
               (pkt ? pkt->data : NULL));
-        mutex_unlock(&_mutex);
         return NULL;
     }
+    /* the marked chunk also includes the bytes in front of data */
+    required_new_size = _chunk_size(_offset(pkt->data) + size);
     /* create new snip descriptor for marked data */
-    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    marked_snip = _cache_get();
+    mutex_lock(&_mutex);
+    if (marked_snip == NULL) {
+        marked_snip = _snip_alloc();
+    }
     if (marked_snip == NULL) {
         DEBUG("pktbuf: could not reallocate marked section.\n");
         mutex_unlock(&_mutex);
@@ -132,19 +230,20 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     /* marked data would not fit _unused_t marker => move data around to allow
      * for proper free */
     if ((pkt->size != size) &&
-        ((size < required_new_size) || ((pkt->size - size) < sizeof(_unused_t)))) {
+        (((_offset(pkt->data) + size) < required_new_size) ||
+         ((pkt->size - size) < sizeof(_unused_t)))) {
         void *new_data_rest;
         new_data_marked = _pktbuf_alloc(size);
         if (new_data_marked == NULL) {
             DEBUG("pktbuf: could not reallocate marked section.\n");
-            _pktbuf_free(marked_snip, sizeof(gnrc_pktsnip_t));
+            _snip_free(marked_snip);
             mutex_unlock(&_mutex);
             return NULL;
         }
         new_data_rest = _pktbuf_alloc(pkt->size - size);
         if (new_data_rest == NULL) {
             DEBUG("pktbuf: could not reallocate remaining section.\n");
-            _pktbuf_free(marked_snip, sizeof(gnrc_pktsnip_t));
+            _snip_free(marked_snip);
             _pktbuf_free(new_data_marked, size);
             mutex_unlock(&_mutex);
             return NULL;
@@ -170,11 +269,12 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
 
 int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
-    size_t aligned_size = (size < sizeof(_unused_t)) ?
-                          _align(sizeof(_unused_t)) : _align(size);
+    size_t offset, aligned_size;
 
     mutex_lock(&_mutex);
     assert(pkt != NULL);
+    offset = (pkt->data != NULL) ? _offset(pkt->data) : 0;
+    aligned_size = _chunk_size(offset + size);
     assert(((pkt->size == 0) && (pkt->data == NULL)) ||
            ((pkt->size > 0) && (pkt->data != NULL) && _pktbuf_contains(pkt->data)));
     /* new size and old size are equal */
@@ -191,7 +291,7 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
     }
     /* if new size is bigger than old size */
     else if ((size > pkt->size) ||                          /* new size does not fit */
-        ((pkt->size - aligned_size) < sizeof(_unused_t))) { /* resulting hole would not fit marker */
+        (((offset + pkt->size) - aligned_size) < sizeof(_unused_t))) { /* resulting hole would not fit marker */
         void *new_data = _pktbuf_alloc(size);
         if (new_data == NULL) {
             DEBUG("pktbuf: error allocating new data section\n");
@@ -204,9 +304,9 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         _pktbuf_free(pkt->data, pkt->size);
         pkt->data = new_data;
     }
-    else if (_align(pkt->size) > aligned_size) {
-        _pktbuf_free(((uint8_t *)pkt->data) + aligned_size,
-                     pkt->size - aligned_size);
+    else if (_align(offset + pkt->size) > aligned_size) {
+        _pktbuf_free(((uint8_t *)pkt->data) - offset + aligned_size,
+                     (offset + pkt->size) - aligned_size);
     }
     pkt->size = size;
     mutex_unlock(&_mutex);
@@ -215,12 +315,16 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 
 void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
 {
-    mutex_lock(&_mutex);
     while (pkt) {
-        pkt->users += num;
+        atomic_fetch_add(&pkt->users, num);
         pkt = pkt->next;
     }
-    mutex_unlock(&_mutex);
+}
+
+static inline void _free_snip_and_data(gnrc_pktsnip_t *pkt)
+{
+    _pktbuf_free(pkt->data, pkt->size);
+    _snip_free(pkt);
 }
 
 static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
@@ -229,44 +333,55 @@ static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
         gnrc_pktsnip_t *tmp;
         assert(_pktbuf_contains(pkt));
         tmp = pkt->next;
-        if (pkt->users == 1) {
-            pkt->users = 0; /* not necessary but to be on the safe side */
-            _pktbuf_free(pkt->data, pkt->size);
-            _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
-        }
-        else {
-            pkt->users--;
-        }
         DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
         gnrc_neterr_report(pkt, err);
+        if (atomic_fetch_sub(&pkt->users, 1) == 1) {
+            _free_snip_and_data(pkt);
+        }
         pkt = tmp;
     }
 }
 
 void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
 {
-    mutex_lock(&_mutex);
-    _release_error_locked(pkt, err);
-    mutex_unlock(&_mutex);
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_pktbuf_contains(pkt));
+        /* pkt may be freed by another user as soon as we dropped our
+         * reference, so read and report everything before */
+        tmp = pkt->next;
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        /* we were the last user => only now the lock is needed, unless
+         * there is no data to free and the snip goes to the cache */
+        if ((atomic_fetch_sub(&pkt->users, 1) == 1) &&
+            ((pkt->data != NULL) || !_cache_put(pkt))) {
+            mutex_lock(&_mutex);
+            _free_snip_and_data(pkt);
+            mutex_unlock(&_mutex);
+        }
+        pkt = tmp;
+    }
 }
 
 gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
 {
-    mutex_lock(&_mutex);
     if ((pkt == NULL) || (pkt->size == 0)) {
-        mutex_unlock(&_mutex);
         return NULL;
     }
-    if (pkt->users > 1) {
-        gnrc_pktsnip_t *new;
-        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
-        if (new != NULL) {
-            pkt->users--;
+    if (atomic_load(&pkt->users) > 1) {
+        gnrc_pktsnip_t *new = _cache_get();
+        mutex_lock(&_mutex);
+        new = _create_snip(new, pkt->next, pkt->data, pkt->size, pkt->type);
+        /* the other users might have released pkt in the meantime, so
+         * free it if we were the last one */
+        if ((new != NULL) && (atomic_fetch_sub(&pkt->users, 1) == 1)) {
+            /* pkt->next is now referenced by new */
+            _free_snip_and_data(pkt);
         }
         mutex_unlock(&_mutex);
         return new;
     }
-    mutex_unlock(&_mutex);
     return pkt;
 }
 
@@ -363,10 +478,65 @@ void gnrc_pktbuf_stats(void)
 #endif
 
 #ifdef TEST_SUITES
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+static bool _is_cached(uint8_t *ptr)
+{
+    for (unsigned i = 0; i <= KERNEL_PID_LAST; i++) {
+        for (gnrc_pktsnip_t *pkt = _cache[i]; pkt != NULL; pkt = pkt->next) {
+            if ((uint8_t *)pkt == ptr) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/* checks if [start, end) only contains cached snips and the holes too small
+ * for an _unused_t marker that can be left next to them */
+static bool _only_cached(uint8_t *start, uint8_t *end)
+{
+    while (start < end) {
+        size_t hole = 0;
+
+        while ((hole < sizeof(_unused_t)) && ((start + hole) < end) &&
+               !_is_cached(start + hole)) {
+            hole += _ALIGNMENT_MASK + 1;
+        }
+        if (hole >= sizeof(_unused_t)) {
+            return false;
+        }
+        start += hole;
+        if (start < end) {
+            start += _chunk_size(sizeof(gnrc_pktsnip_t));
+        }
+    }
+    return true;
+}
+#endif
+
 bool gnrc_pktbuf_is_empty(void)
 {
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+    /* cached snips are free, so every chunk not on the list of unused chunks
+     * must be one of them */
+    uint8_t *chunk = _pktbuf;
+    bool res = true;
+    unsigned state;
+
+    mutex_lock(&_mutex);
+    state = irq_disable();
+    for (_unused_t *ptr = _first_unused; res && (ptr != NULL); ptr = ptr->next) {
+        res = _only_cached(chunk, (uint8_t *)ptr);
+        chunk = ((uint8_t *)ptr) + ptr->size;
+    }
+    res = res && _only_cached(chunk, &_pktbuf[GNRC_PKTBUF_SIZE]);
+    irq_restore(state);
+    mutex_unlock(&_mutex);
+    return res;
+#else
     return (_first_unused == (_unused_t *)_pktbuf) &&
            (_first_unused->size == sizeof(_pktbuf));
+#endif
 }
 
 bool gnrc_pktbuf_is_sane(void)
@@ -401,12 +571,17 @@ bool gnrc_pktbuf_is_sane(void)
 }
 #endif
 
-static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, void *data, size_t size,
+/* pkt is a snip descriptor taken from the cache before locking or NULL to
+ * allocate a new one */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                    void *data, size_t size,
                                     gnrc_nettype_t type)
 {
-    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
     void *_data = NULL;
 
+    if (pkt == NULL) {
+        pkt = _snip_alloc();
+    }
     if (pkt == NULL) {
         DEBUG("pktbuf: error allocating new packet snip\n");
         return NULL;
@@ -415,7 +590,7 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, void *data, size_t siz
         _data = _pktbuf_alloc(size);
         if (_data == NULL) {
             DEBUG("pktbuf: error allocating data for new packet snip\n");
-            _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+            _snip_free(pkt);
             return NULL;
         }
     }
@@ -436,6 +611,12 @@ static void *_pktbuf_alloc(size_t size)
         ptr = ptr->next;
     }
     if (ptr == NULL) {
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+        /* try again with the cached snips of all threads returned */
+        if (_cache_flush()) {
+            return _pktbuf_alloc(size);
+        }
+#endif
         DEBUG("pktbuf: no space left in packet buffer\n");
         return NULL;
     }
@@ -490,11 +671,15 @@ static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
 static void _pktbuf_free(void *data, size_t size)
 {
     size_t bytes_at_end;
-    _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
+    _unused_t *new, *prev = NULL, *ptr = _first_unused;
 
     if (!_pktbuf_contains(data)) {
         return;
     }
+    /* free the whole chunk if data does not start at its beginning */
+    size += _offset(data);
+    data = ((uint8_t *)data) - _offset(data);
+    new = (_unused_t *)data;
     while (ptr && (((void *)ptr) < data)) {
         prev = ptr;
         ptr = ptr->next;
@@ -523,6 +708,88 @@ static void _pktbuf_free(void *data, size_t size)
     }
 }
 
+/* requires _mutex */
+static gnrc_pktsnip_t *_snip_alloc(void)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+    if (pkt != NULL) {
+        pkt->owner = thread_getpid();
+    }
+#endif
+    return pkt;
+}
+
+/* requires _mutex */
+static void _snip_free(gnrc_pktsnip_t *pkt)
+{
+    if (!_cache_put(pkt)) {
+        _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+    }
+}
+
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+static gnrc_pktsnip_t *_cache_get(void)
+{
+    kernel_pid_t pid = thread_getpid();
+    unsigned state = irq_disable();
+    gnrc_pktsnip_t *pkt = _cache[pid];
+
+    if (pkt != NULL) {
+        _cache[pid] = pkt->next;
+        _cache_numof[pid]--;
+    }
+    irq_restore(state);
+    return pkt;
+}
+
+static bool _cache_put(gnrc_pktsnip_t *pkt)
+{
+    kernel_pid_t pid = thread_getpid();
+    bool res = false;
+    unsigned state;
+
+    /* a thread that only receives packets would otherwise hoard the snips
+     * allocated by other threads */
+    if (pkt->owner != pid) {
+        return false;
+    }
+    state = irq_disable();
+    if (_cache_numof[pid] < GNRC_PKTBUF_STATIC_CACHE_SIZE) {
+        pkt->next = _cache[pid];
+        _cache[pid] = pkt;
+        _cache_numof[pid]++;
+        res = true;
+    }
+    irq_restore(state);
+    return res;
+}
+
+/* returns the snips of all caches to the packet buffer, returns true if
+ * there were any, requires _mutex */
+static bool _cache_flush(void)
+{
+    bool flushed = false;
+
+    for (unsigned i = 0; i <= KERNEL_PID_LAST; i++) {
+        unsigned state = irq_disable();
+        gnrc_pktsnip_t *pkt = _cache[i];
+
+        _cache[i] = NULL;
+        _cache_numof[i] = 0;
+        irq_restore(state);
+        while (pkt != NULL) {
+            gnrc_pktsnip_t *next = pkt->next;
+
+            _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+            pkt = next;
+            flushed = true;
+        }
+    }
+    return flushed;
+}
+#endif
 
 gnrc_pktsnip_t *gnrc_pktbuf_remove_snip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *snip)
 {
@@ -558,9 +825,11 @@ gnrc_pktsnip_t *gnrc_pktbuf_replace_snip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *ol
 
 gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
 {
+    gnrc_pktsnip_t *new = _cache_get();
+
     mutex_lock(&_mutex);
 
-    bool is_shared = pkt->users > 1;
+    bool is_shared = atomic_load(&pkt->users) > 1;
     size_t size = gnrc_pkt_len_upto(pkt, type);
 
     DEBUG("ipv6_ext: duplicating %d octets\n", (int) size);
@@ -568,7 +837,8 @@ gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t t
     gnrc_pktsnip_t *tmp;
     gnrc_pktsnip_t *target = gnrc_pktsnip_search_type(pkt, type);
     gnrc_pktsnip_t *next = (target == NULL) ? NULL : target->next;
-    gnrc_pktsnip_t *new = _create_snip(next, NULL, size, type);
+
+    new = _create_snip(new, next, NULL, size, type);
 
     if (new == NULL) {
         mutex_unlock(&_mutex);
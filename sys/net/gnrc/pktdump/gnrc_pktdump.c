@@ -140,6 +140,18 @@ static void *_eventloop(void *arg)
                 puts("PKTDUMP: data received:");
                 _dump(msg.content.ptr);
                 break;
+#ifdef MODULE_GNRC_NETAPI_BATCH
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH: {
+                gnrc_pktsnip_t *batch = msg.content.ptr;
+
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(batch); i++) {
+                    puts("PKTDUMP: data received:");
+                    _dump(gnrc_netapi_batch_get(batch, i));
+                }
+                gnrc_pktbuf_release(batch);
+                break;
+            }
+#endif
             case GNRC_NETAPI_MSG_TYPE_SND:
                 puts("PKTDUMP: data to send:");
                 _dump(msg.content.ptr);
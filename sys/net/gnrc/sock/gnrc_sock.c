@@ -44,10 +44,43 @@ static void _callback_put(void *arg)
 }
 #endif
 
+#ifdef MODULE_GNRC_SOCK_EVENT
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    gnrc_sock_reg_t *reg = ctx;
+    msg_t msg = { .type = cmd, .content = { .ptr = pkt } };
+
+    if ((cmd != GNRC_NETAPI_MSG_TYPE_RCV) || (mbox_try_put(&reg->mbox, &msg) < 1)) {
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    if (reg->event_queue != NULL) {
+        event_post(reg->event_queue, reg->event);
+    }
+}
+
+void gnrc_sock_set_event(gnrc_sock_reg_t *reg, event_queue_t *queue,
+                         event_t *event)
+{
+    reg->event = event;
+    reg->event_queue = queue;
+}
+#endif
+
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx)
 {
     mbox_init(&reg->mbox, reg->mbox_queue, SOCK_MBOX_SIZE);
+#ifdef MODULE_GNRC_SOCK_EVENT
+    /* deliver via callback, so the event can be posted after the packet was
+     * put into the mbox */
+    reg->netreg_cb.cb = _netapi_cb;
+    reg->netreg_cb.ctx = reg;
+    reg->event_queue = NULL;
+    reg->event = NULL;
+    gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
+#else
     gnrc_netreg_entry_init_mbox(&reg->entry, demux_ctx, &reg->mbox);
+#endif
     gnrc_netreg_register(type, &reg->entry);
 }
 
@@ -32,6 +32,10 @@
 #include "net/sock/ip.h"
 #include "net/sock/udp.h"
 
+#ifdef MODULE_GNRC_SOCK_EVENT
+#include "event.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -51,8 +55,32 @@ typedef struct gnrc_sock_reg {
     gnrc_netreg_entry_t entry;          /**< @ref net_gnrc_netreg entry for mbox */
     mbox_t mbox;                        /**< @ref core_mbox target for the sock */
     msg_t mbox_queue[SOCK_MBOX_SIZE];   /**< queue for gnrc_sock_reg_t::mbox */
+#if defined(MODULE_GNRC_SOCK_EVENT) || defined(DOXYGEN)
+    gnrc_netreg_entry_cbd_t netreg_cb;  /**< callback filling gnrc_sock_reg_t::mbox */
+    event_queue_t *event_queue;         /**< queue to notify, may be NULL */
+    event_t *event;                     /**< event posted on reception */
+#endif
 } gnrc_sock_reg_t;
 
+#if defined(MODULE_GNRC_SOCK_EVENT) || defined(DOXYGEN)
+/**
+ * @brief   Post an event whenever a packet was queued for a sock
+ *
+ * This allows a thread to wait for packets of many socks (and other events)
+ * in one @ref core_event "event queue" instead of blocking in a receive
+ * function. The handler of @p event should then receive from the sock with
+ * a timeout of 0 until no packets are left.
+ *
+ * @note    Only available with the `gnrc_sock_event` module.
+ *
+ * @param[in] reg   the sock's netreg info, e.g. `&sock->reg`
+ * @param[in] queue queue to post @p event to, NULL to disable notifications
+ * @param[in] event event to post
+ */
+void gnrc_sock_set_event(gnrc_sock_reg_t *reg, event_queue_t *queue,
+                         event_t *event);
+#endif
+
 /**
  * @brief   Raw IP sock type
  * @internal
@@ -29,6 +29,11 @@
 #include "net/gnrc.h"
 #include "net/inet_csum.h"
 
+#ifdef MODULE_EVENT_THREAD
+#include "cib.h"
+#include "irq.h"
+#include "event/thread.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -38,6 +43,19 @@
  */
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
+#ifdef MODULE_EVENT_THREAD
+/**
+ * @brief   Packets handed to UDP, processed on the shared event thread
+ */
+static struct {
+    gnrc_pktsnip_t *pkt;
+    uint16_t cmd;
+} _queue[GNRC_UDP_MSG_QUEUE_SIZE];
+static cib_t _queue_cib = CIB_INIT(GNRC_UDP_MSG_QUEUE_SIZE);
+static event_t _event;
+static gnrc_netreg_entry_cbd_t _netreg_cb;
+static gnrc_netreg_entry_t _netreg;
+#else
 /**
  * @brief   Allocate memory for the UDP thread's stack
  */
@@ -46,6 +64,7 @@ static char _stack[GNRC_UDP_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
 #else
 static char _stack[GNRC_UDP_STACK_SIZE];
 #endif
+#endif
 
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
@@ -217,6 +236,57 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+#ifdef MODULE_EVENT_THREAD
+static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+    unsigned state = irq_disable();
+    int idx = cib_put(&_queue_cib);
+
+    if (idx >= 0) {
+        _queue[idx].pkt = pkt;
+        _queue[idx].cmd = cmd;
+    }
+    irq_restore(state);
+    if (idx < 0) {
+        DEBUG("udp: queue full, dropping packet\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    event_post(&event_thread_queue, &_event);
+}
+
+static void _event_handler(event_t *event)
+{
+    (void)event;
+
+    while (1) {
+        unsigned state = irq_disable();
+        int idx = cib_get(&_queue_cib);
+        gnrc_pktsnip_t *pkt = (idx >= 0) ? _queue[idx].pkt : NULL;
+        uint16_t cmd = (idx >= 0) ? _queue[idx].cmd : 0;
+        irq_restore(state);
+
+        if (pkt == NULL) {
+            return;
+        }
+        switch (cmd) {
+            case GNRC_NETAPI_MSG_TYPE_RCV:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
+                _receive(pkt);
+                break;
+            case GNRC_NETAPI_MSG_TYPE_SND:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
+                _send(pkt);
+                break;
+            default:
+                DEBUG("udp: received unidentified command\n");
+                gnrc_pktbuf_release(pkt);
+                break;
+        }
+    }
+}
+#else
 static void *_event_loop(void *arg)
 {
     (void)arg;
@@ -257,6 +327,7 @@ static void *_event_loop(void *arg)
     /* never reached */
     return NULL;
 }
+#endif
 
 int gnrc_udp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
 {
@@ -298,6 +369,19 @@ gnrc_pktsnip_t *gnrc_udp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src,
 
 int gnrc_udp_init(void)
 {
+#ifdef MODULE_EVENT_THREAD
+    if (_pid == KERNEL_PID_UNDEF) {
+        _event.handler = _event_handler;
+        _netreg_cb.cb = _netapi_cb;
+        _netreg_cb.ctx = NULL;
+        gnrc_netreg_entry_init_cb(&_netreg, GNRC_NETREG_DEMUX_CTX_ALL,
+                                  &_netreg_cb);
+        gnrc_netreg_register(GNRC_NETTYPE_UDP, &_netreg);
+        /* UDP has no thread of its own, report the one it runs on */
+        _pid = event_thread_init();
+    }
+    return _pid;
+#else
     /* check if thread is already running */
     if (_pid == KERNEL_PID_UNDEF) {
         /* start UDP thread */
@@ -305,4 +389,5 @@ int gnrc_udp_init(void)
                              THREAD_CREATE_STACKTEST, _event_loop, NULL, "udp");
     }
     return _pid;
+#endif
 }
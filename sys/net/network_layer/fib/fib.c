@@ -20,6 +20,7 @@
  */
 
 #include <stdio.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
@@ -37,6 +38,10 @@
 #include "net/fib.h"
 #include "net/fib/table.h"
 
+#ifdef MODULE_FIB_TRIE
+#include "fib_trie.h"
+#endif
+
 #ifdef MODULE_IPV6_ADDR
 #include "net/ipv6/addr.h"
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
@@ -65,6 +70,56 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief advances the generation after an entry was added or updated
+ *
+ * @param[in] table     the FIB table the entry is in
+ * @param[in] lifetime  the absolute lifetime of the entry
+ */
+static void fib_changed(fib_table_t *table, uint64_t lifetime)
+{
+    table->generation++;
+#ifdef MODULE_FIB_TRIE
+    fib_trie_expire_at(table, lifetime);
+#else
+    if ((lifetime != FIB_LIFETIME_NO_EXPIRE) &&
+        ((table->next_expiry == 0) || (lifetime < table->next_expiry))) {
+        table->next_expiry = lifetime;
+    }
+#endif
+}
+
+#ifdef MODULE_FIB_TRIE
+/**
+ * @brief removes all expired entries and sets the timer for the next expiry
+ *
+ * @param[in] table     the FIB table to sweep
+ */
+static void fib_trie_sweep(fib_table_t *table)
+{
+    uint64_t now = xtimer_now_usec64();
+
+    table->trie_sweep = 0;
+    table->trie_next_expiry = 0;
+
+    for (size_t i = 0; i < table->size; ++i) {
+        fib_entry_t *entry = &table->data.entries[i];
+
+        if ((entry->global == NULL) || (entry->lifetime == FIB_LIFETIME_NO_EXPIRE)) {
+            continue;
+        }
+        if (entry->lifetime < now) {
+            fib_remove(table, entry);
+        }
+        else {
+            fib_trie_expire_at(table, entry->lifetime);
+        }
+    }
+}
+#endif
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -81,6 +136,18 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
+#ifdef MODULE_FIB_TRIE
+    /* expired entries are removed by a timer-triggered sweep, so lookups
+     * don't need to check lifetimes */
+    if (table->trie_sweep) {
+        fib_trie_sweep(table);
+    }
+
+    int ret = fib_trie_find(table, dst, dst_size, &entry_arr[0]);
+
+    *entry_arr_size = (ret >= 0) ? 1 : 0;
+    return ret;
+#else
     uint64_t now = xtimer_now_usec64();
 
     size_t count = 0;
@@ -187,6 +254,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 
     *entry_arr_size = count;
     return ret;
+#endif
 }
 
 /**
@@ -268,6 +336,19 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
 
+#ifdef MODULE_FIB_TRIE
+                if (fib_trie_insert(table, &table->data.entries[i]) != 0) {
+                    /* only if the node pool is smaller than
+                     * FIB_TRIE_POOL_SIZE(table->size) */
+                    table->data.entries[i].trie_next = NULL;
+                    universal_address_rem(table->data.entries[i].global);
+                    universal_address_rem(table->data.entries[i].next_hop);
+                    memset(&table->data.entries[i], 0,
+                           offsetof(fib_entry_t, trie_next));
+                    return -ENOMEM;
+                }
+#endif
+                fib_changed(table, table->data.entries[i].lifetime);
                 return 0;
             }
         }
@@ -279,13 +360,19 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table the entry is in
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
     if (entry->global != NULL) {
+#ifdef MODULE_FIB_TRIE
+        fib_trie_remove(table, entry);
+#else
+        (void)table;
+#endif
         universal_address_rem(entry->global);
     }
 
@@ -300,6 +387,7 @@ static int fib_remove(fib_entry_t *entry)
 
     entry->iface_id = KERNEL_PID_UNDEF;
     entry->lifetime = 0;
+    table->generation++;
 
     return 0;
 }
@@ -404,6 +492,7 @@ int fib_add_entry(fib_table_t *table,
     if (ret == 1) {
         /* we must take the according entry and update the values */
         ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        fib_changed(table, entry[0]->lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -434,6 +523,7 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
         ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        fib_changed(table, entry[0]->lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -457,7 +547,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -477,7 +567,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -596,7 +686,13 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#ifdef MODULE_FIB_TRIE
+        fib_trie_init(table);
+#else
+        table->next_expiry = 0;
+#endif
     }
+    table->generation++;
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
 }
@@ -620,8 +716,17 @@ void fib_deinit(fib_table_t *table)
                sizeof(fib_sr_entry_t) * table->data.source_routes->entry_pool_size);
     }
     else {
+#ifdef MODULE_FIB_TRIE
+        fib_trie_deinit(table);
+#endif
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#ifdef MODULE_FIB_TRIE
+        fib_trie_init(table);
+#else
+        table->next_expiry = 0;
+#endif
     }
+    table->generation++;
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
 }
@@ -665,6 +770,30 @@ int fib_get_num_used_entries(fib_table_t *table)
     return used_entries;
 }
 
+unsigned fib_get_generation(fib_table_t *table)
+{
+#ifndef MODULE_FIB_TRIE
+    /* entries expire lazily on lookup, so expiries are accounted for here */
+    if ((table->next_expiry != 0) && (table->next_expiry <= xtimer_now_usec64())) {
+        mutex_lock(&(table->mtx_access));
+        uint64_t now = xtimer_now_usec64();
+
+        table->next_expiry = 0;
+        for (size_t i = 0; i < table->size; ++i) {
+            uint64_t lifetime = table->data.entries[i].lifetime;
+
+            if ((lifetime != FIB_LIFETIME_NO_EXPIRE) && (lifetime > now) &&
+                ((table->next_expiry == 0) || (lifetime < table->next_expiry))) {
+                table->next_expiry = lifetime;
+            }
+        }
+        table->generation++;
+        mutex_unlock(&(table->mtx_access));
+    }
+#endif
+    return table->generation;
+}
+
 /* source route handling */
 int fib_sr_create(fib_table_t *table, fib_sr_t **fib_sr, kernel_pid_t sr_iface_id,
                   uint32_t sr_flags, uint32_t sr_lifetime)
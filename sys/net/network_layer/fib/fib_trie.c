@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_fib
+ * @{
+ *
+ * @file
+ * @brief       Longest-prefix-match trie index for FIB tables
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#ifdef MODULE_FIB_TRIE
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "xtimer.h"
+#include "net/fib.h"
+
+#include "fib_trie.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/**
+ * @brief   Returns bit @p idx of @p key, counted from the most significant
+ *          bit of the first byte
+ */
+static inline unsigned _bit(const uint8_t *key, unsigned idx)
+{
+    return (key[idx >> 3] >> (7 - (idx & 0x7))) & 0x1;
+}
+
+/**
+ * @brief   Returns the index of the first bit in [@p from, @p to) that
+ *          differs between @p a and @p b, or @p to if there is none
+ */
+static unsigned _first_diff(const uint8_t *a, const uint8_t *b,
+                            unsigned from, unsigned to)
+{
+    unsigned i = from;
+
+    while (i < to) {
+        uint8_t diff = (a[i >> 3] ^ b[i >> 3]) & (0xff >> (i & 0x7));
+
+        if (diff != 0) {
+            unsigned pos = i & ~0x7U;
+
+            while (!(diff & 0x80)) {
+                diff <<= 1;
+                pos++;
+            }
+            return (pos < to) ? pos : to;
+        }
+        i = (i & ~0x7U) + 8;
+    }
+    return to;
+}
+
+/**
+ * @brief   Builds the trie key for an address
+ *
+ * The address size is put in front of the address, so addresses of different
+ * sizes never share a prefix.
+ *
+ * @return  length of the full key in bits
+ */
+static unsigned _key(uint8_t *key, const uint8_t *addr, size_t addr_size)
+{
+    key[0] = (uint8_t)addr_size;
+    memcpy(&key[1], addr, addr_size);
+    return (addr_size + 1) << 3;
+}
+
+/**
+ * @brief   Builds the trie key for the destination of @p entry
+ *
+ * @return  length of the entry's prefix in bits, including the size byte
+ */
+static unsigned _entry_key(const fib_entry_t *entry, uint8_t *key)
+{
+    const universal_address_container_t *global = entry->global;
+    unsigned len = _key(key, global->address, global->address_size) - 8;
+    bool all_zeros = true;
+
+    for (unsigned i = 0; i < global->address_size; i++) {
+        if (global->address[i] != 0) {
+            all_zeros = false;
+            break;
+        }
+    }
+    if (all_zeros) {
+        /* default route, e.g. ::/0 for IPv6 */
+        len = 0;
+    }
+    else if (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK) {
+        unsigned prefix_len = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                              >> FIB_FLAG_NET_PREFIX_SHIFT;
+        if (prefix_len < len) {
+            len = prefix_len;
+        }
+    }
+    return len + 8;
+}
+
+static fib_trie_node_t *_node_alloc(fib_table_t *table, const uint8_t *key,
+                                    unsigned len, fib_entry_t *entry)
+{
+    fib_trie_node_t *node = table->trie_free;
+
+    if (node != NULL) {
+        table->trie_free = node->child[0];
+        node->child[0] = NULL;
+        node->child[1] = NULL;
+        node->entries = entry;
+        node->len = len;
+        memcpy(node->key, key, (len + 7) >> 3);
+    }
+    return node;
+}
+
+static void _node_free(fib_table_t *table, fib_trie_node_t *node)
+{
+    node->child[0] = table->trie_free;
+    table->trie_free = node;
+}
+
+static void _expire_cb(void *arg)
+{
+    fib_table_t *table = arg;
+
+    table->trie_sweep = 1;
+    table->generation++;
+}
+
+void fib_trie_init(fib_table_t *table)
+{
+    table->trie_root = NULL;
+    table->trie_free = NULL;
+    for (size_t i = 0; i < table->trie_pool_size; i++) {
+        _node_free(table, &table->trie_pool[i]);
+    }
+    memset(&table->trie_timer, 0, sizeof(table->trie_timer));
+    table->trie_timer.callback = _expire_cb;
+    table->trie_timer.arg = table;
+    table->trie_next_expiry = 0;
+    table->trie_sweep = 0;
+}
+
+void fib_trie_deinit(fib_table_t *table)
+{
+    xtimer_remove(&table->trie_timer);
+    table->trie_next_expiry = 0;
+    table->trie_sweep = 0;
+}
+
+int fib_trie_insert(fib_table_t *table, fib_entry_t *entry)
+{
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+    unsigned len = _entry_key(entry, key);
+    fib_trie_node_t **link = &table->trie_root;
+    fib_trie_node_t *node;
+    unsigned from = 0;
+
+    entry->trie_next = NULL;
+    while ((node = *link) != NULL) {
+        unsigned diff = _first_diff(node->key, key, from,
+                                    (node->len < len) ? node->len : len);
+
+        if (diff < node->len) {
+            /* the new prefix ends or branches off within the prefix of
+             * node, so it has to be put in front of it */
+            fib_trie_node_t *leaf = _node_alloc(table, key, len, entry);
+
+            if (leaf == NULL) {
+                return -ENOMEM;
+            }
+            if (diff == len) {
+                leaf->child[_bit(node->key, len)] = node;
+                *link = leaf;
+            }
+            else {
+                fib_trie_node_t *branch = _node_alloc(table, key, diff, NULL);
+
+                if (branch == NULL) {
+                    _node_free(table, leaf);
+                    return -ENOMEM;
+                }
+                branch->child[_bit(key, diff)] = leaf;
+                branch->child[_bit(node->key, diff)] = node;
+                *link = branch;
+            }
+            return 0;
+        }
+        if (node->len == len) {
+            /* same prefix, but the address may differ after it */
+            entry->trie_next = node->entries;
+            node->entries = entry;
+            return 0;
+        }
+        from = node->len;
+        link = &node->child[_bit(key, node->len)];
+    }
+    if ((*link = _node_alloc(table, key, len, entry)) == NULL) {
+        return -ENOMEM;
+    }
+    return 0;
+}
+
+void fib_trie_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+    unsigned len = _entry_key(entry, key);
+    fib_trie_node_t **link = &table->trie_root, **parent_link = NULL;
+    fib_trie_node_t *node;
+    fib_entry_t **e;
+
+    while (((node = *link) != NULL) && (node->len < len)) {
+        parent_link = link;
+        link = &node->child[_bit(key, node->len)];
+    }
+    if ((node == NULL) || (node->len != len)) {
+        DEBUG("[fib_trie_remove] entry %p not found\n", (void *)entry);
+        return;
+    }
+    for (e = &node->entries; (*e != NULL) && (*e != entry); e = &(*e)->trie_next) {}
+    if (*e == NULL) {
+        DEBUG("[fib_trie_remove] entry %p not found\n", (void *)entry);
+        return;
+    }
+    *e = entry->trie_next;
+    entry->trie_next = NULL;
+    if ((node->entries != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        /* node is still needed for other entries or as branching point */
+        return;
+    }
+    *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _node_free(table, node);
+    if ((*link == NULL) && (parent_link != NULL)) {
+        /* node was a leaf, so its parent might be a branching point without
+         * anything left to branch */
+        fib_trie_node_t *parent = *parent_link;
+
+        if (parent->entries == NULL) {
+            *parent_link = (parent->child[0] != NULL) ? parent->child[0]
+                                                      : parent->child[1];
+            _node_free(table, parent);
+        }
+    }
+}
+
+int fib_trie_find(fib_table_t *table, const uint8_t *dst, size_t dst_size,
+                  fib_entry_t **entry)
+{
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+    unsigned len;
+    fib_trie_node_t *node = table->trie_root;
+    fib_entry_t *best = NULL;
+    unsigned from = 0;
+
+    if (dst_size > UNIVERSAL_ADDRESS_SIZE) {
+        return -EHOSTUNREACH;
+    }
+    len = _key(key, dst, dst_size);
+    while ((node != NULL) && (node->len <= len) &&
+           (_first_diff(node->key, key, from, node->len) == node->len)) {
+        for (fib_entry_t *e = node->entries; e != NULL; e = e->trie_next) {
+            if ((e->global->address_size == dst_size) &&
+                (memcmp(e->global->address, dst, dst_size) == 0)) {
+                *entry = e;
+                return 1;
+            }
+        }
+        if (node->entries != NULL) {
+            best = node->entries;
+        }
+        if (node->len == len) {
+            break;
+        }
+        from = node->len;
+        node = node->child[_bit(key, node->len)];
+    }
+    if (best != NULL) {
+        *entry = best;
+        return 0;
+    }
+    return -EHOSTUNREACH;
+}
+
+void fib_trie_expire_at(fib_table_t *table, uint64_t lifetime)
+{
+    uint64_t now, offset;
+
+    if ((lifetime == FIB_LIFETIME_NO_EXPIRE) ||
+        ((table->trie_next_expiry != 0) && (table->trie_next_expiry <= lifetime))) {
+        return;
+    }
+    now = xtimer_now_usec64();
+    offset = (lifetime > now) ? (lifetime - now) : 0;
+    if (offset > UINT32_MAX) {
+        /* the sweep will set the timer again */
+        offset = UINT32_MAX;
+    }
+    table->trie_next_expiry = now + offset;
+    xtimer_set(&table->trie_timer, (uint32_t)offset);
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_FIB_TRIE */
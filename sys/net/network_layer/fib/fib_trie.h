@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_fib
+ * @{
+ *
+ * @file
+ * @brief       Longest-prefix-match trie index for FIB tables
+ *
+ * The trie is a compressed binary (Patricia) trie over the destination
+ * addresses of the entries of a single hop FIB table. Lookups are done in
+ * O(address length), independent of the number of entries. Expired entries
+ * are not removed on lookup but by a timer-triggered sweep.
+ *
+ * @note    All functions expect the table's access mutex to be held.
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef FIB_TRIE_H
+#define FIB_TRIE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/fib/table.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Initializes the trie and its node pool for @p table
+ *
+ * @pre     The entries of @p table are zeroed.
+ *
+ * @param[in] table     the FIB table
+ */
+void fib_trie_init(fib_table_t *table);
+
+/**
+ * @brief   Stops the expiry timer of @p table
+ *
+ * @param[in] table     the FIB table
+ */
+void fib_trie_deinit(fib_table_t *table);
+
+/**
+ * @brief   Adds an entry with a valid destination address to the trie
+ *
+ * @param[in] table     the FIB table
+ * @param[in] entry     the entry
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if the node pool is exhausted
+ */
+int fib_trie_insert(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief   Removes an entry from the trie
+ *
+ * @param[in] table     the FIB table
+ * @param[in] entry     the entry, must have been added with fib_trie_insert()
+ */
+void fib_trie_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief   Finds the entry for a destination address
+ *
+ * @param[in] table     the FIB table
+ * @param[in] dst       the destination address
+ * @param[in] dst_size  the destination address size
+ * @param[out] entry    the found entry
+ *
+ * @return  1 if an entry with exactly @p dst was found
+ * @return  0 if the entry with the longest matching prefix was found
+ * @return  -EHOSTUNREACH if no entry matches
+ */
+int fib_trie_find(fib_table_t *table, const uint8_t *dst, size_t dst_size,
+                  fib_entry_t **entry);
+
+/**
+ * @brief   Makes sure the sweep is triggered no later than at @p lifetime
+ *
+ * @param[in] table     the FIB table
+ * @param[in] lifetime  absolute lifetime of an entry
+ */
+void fib_trie_expire_at(fib_table_t *table, uint64_t lifetime);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FIB_TRIE_H */
+/** @} */
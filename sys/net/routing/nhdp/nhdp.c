@@ -261,10 +261,12 @@ static void *_nhdp_runner(void *arg)
 
                 /* TODO: Add jitter */
 
-                /* Schedule next sending */
-                xtimer_set_msg64(&if_entry->if_timer,
-                                 timex_uint64(if_entry->hello_interval),
-                                 &msg_rcvd, thread_getpid());
+                /* Schedule next sending, allow it to be delayed up to the
+                 * maximum jitter to share a timer interrupt with others */
+                xtimer_set_msg64_with_slack(&if_entry->if_timer,
+                                            timex_uint64(if_entry->hello_interval),
+                                            NHDP_HP_MAXJITTER_MS * US_PER_MS,
+                                            &msg_rcvd, thread_getpid());
                 mutex_unlock(&send_rcv_mutex);
                 break;
 
@@ -277,8 +279,9 @@ static void *_nhdp_runner(void *arg)
                 /* Schedule next sending */
                 metric_msg.type = NHDP_METRIC_TIMER;
                 metric_msg.content.ptr = NULL;
-                xtimer_set_msg64(&metric_timer, timex_uint64(metric_interval),
-                                 metric_msg, thread_getpid());
+                xtimer_set_msg64_with_slack(&metric_timer, timex_uint64(metric_interval),
+                                            NHDP_HP_MAXJITTER_MS * US_PER_MS,
+                                            metric_msg, thread_getpid());
                 mutex_unlock(&send_rcv_mutex);
                 break;
 #endif
@@ -30,6 +30,10 @@
 #include "tlsf.h"
 #endif
 
+#ifdef MODULE_THREADSTAT
+#include "threadstat.h"
+#endif
+
 /* list of states copied from tcb.h */
 static const char *state_names[] = {
     [STATUS_RUNNING] = "running",
@@ -94,11 +98,22 @@ void ps(void)
 #ifdef DEVELHELP
             int stacksz = p->stack_size;                                           /* get stack size */
             overall_stacksz += stacksz;
+#ifdef MODULE_THREADSTAT
+            /* use the sampled high-water mark instead of scanning the stack */
+            threadstat_t stat;
+            if (threadstat_get(i, &stat) == 0) {
+                stacksz = stat.stack_used;
+            }
+            else {
+                stacksz -= thread_measure_stack_free(p->stack_start);
+            }
+#else
             stacksz -= thread_measure_stack_free(p->stack_start);
+#endif
             overall_used += stacksz;
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
-            double runtime_ticks =  sched_pidlist[i].runtime_ticks / (double) xtimer_now() * 100;
+            double runtime_ticks =  sched_pidlist[i].runtime_ticks / (double) _xtimer_now() * 100;
             int switches = sched_pidlist[i].schedules;
 #endif
             printf("\t%3" PRIkernel_pid
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_edf
+ * @{
+ *
+ * @file
+ * @brief       EDF scheduling implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "irq.h"
+#include "sched_edf.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define UTIL_MAX    (((uint32_t)SCHED_EDF_UTIL_MAX << 16) / 100)
+
+/* sum of the densities of all admitted threads */
+static uint32_t _util;
+
+/* sets the priority of thread without inheritance, a higher priority it
+ * inherited from threads waiting for its mutexes is kept */
+static void _set_priority(thread_t *thread, uint8_t priority)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    bool boosted = (thread->priority < thread->base_priority);
+
+    thread->base_priority = priority;
+    if (boosted && (thread->priority < priority)) {
+        priority = thread->priority;
+    }
+#endif
+    sched_change_priority(thread, priority);
+}
+
+/* sets the deadline of thread without inheritance, an earlier deadline it
+ * inherited from EDF threads waiting for its mutexes is kept */
+static void _set_deadline(thread_t *thread, uint32_t deadline)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    /* without inheritance, the mutex code keeps both the same */
+    bool inherited = (thread->edf_deadline != thread->edf_base_deadline);
+
+    thread->edf_base_deadline = deadline;
+    if (inherited && ((int32_t)(thread->edf_deadline - deadline) < 0)) {
+        deadline = thread->edf_deadline;
+    }
+#endif
+    sched_set_deadline(thread, deadline);
+}
+
+/* the deadline of the current job of thread */
+static inline uint32_t _deadline(thread_t *thread)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    return thread->edf_base_deadline;
+#else
+    return thread->edf_deadline;
+#endif
+}
+
+static void _wakeup(void *arg)
+{
+    thread_t *thread = arg;
+
+    thread_wakeup(thread->pid);
+}
+
+int sched_edf_enter(sched_edf_t *edf, uint32_t period, uint32_t deadline,
+                    uint32_t wcet)
+{
+    if ((wcet == 0) || (wcet > deadline) || (deadline > period) ||
+        (period > INT32_MAX)) {
+        return -EINVAL;
+    }
+
+    uint32_t util = ((uint64_t)wcet << 16) / deadline;
+    thread_t *me = (thread_t *)sched_active_thread;
+    unsigned state = irq_disable();
+
+    if (_util + util > UTIL_MAX) {
+        irq_restore(state);
+        DEBUG("sched_edf: rejecting thread %" PRIkernel_pid "\n", me->pid);
+        return -EBUSY;
+    }
+    _util += util;
+
+    edf->thread = me;
+    edf->period = period;
+    edf->deadline = deadline;
+    edf->util = util;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    edf->priority = me->base_priority;
+#else
+    edf->priority = me->priority;
+#endif
+    edf->jobs = 0;
+    edf->misses = 0;
+    edf->timer.callback = _wakeup;
+    edf->timer.arg = me;
+    edf->release = xtimer_now_usec();
+
+    /* deadline first, so the EDF run queue is sorted by it */
+    _set_deadline(me, edf->release + deadline);
+    _set_priority(me, SCHED_EDF_PRIORITY);
+
+    irq_restore(state);
+    /* an EDF thread with an earlier deadline might be waiting */
+    thread_yield_higher();
+
+    return 0;
+}
+
+void sched_edf_wait(sched_edf_t *edf)
+{
+    thread_t *me = edf->thread;
+    uint32_t now = xtimer_now_usec();
+
+    assert(me == sched_active_thread);
+
+    edf->jobs++;
+    if ((int32_t)(now - _deadline(me)) > 0) {
+        edf->misses++;
+        DEBUG("sched_edf: thread %" PRIkernel_pid " missed its deadline\n",
+              me->pid);
+    }
+
+    edf->release += edf->period;
+
+    unsigned state = irq_disable();
+
+    if ((int32_t)(edf->release - now) > 0) {
+        /* go to sleep before setting the timer, xtimer fires short
+         * timeouts right away */
+        sched_set_status(me, STATUS_SLEEPING);
+        _set_deadline(me, edf->release + edf->deadline);
+        xtimer_set(&edf->timer, edf->release - now);
+    }
+    else {
+        /* overrun, the next job is due already */
+        _set_deadline(me, edf->release + edf->deadline);
+    }
+
+    irq_restore(state);
+    thread_yield_higher();
+}
+
+void sched_edf_leave(sched_edf_t *edf)
+{
+    thread_t *me = edf->thread;
+
+    assert(me == sched_active_thread);
+
+    unsigned state = irq_disable();
+
+    xtimer_remove(&edf->timer);
+    _util -= edf->util;
+    _set_priority(me, edf->priority);
+
+    irq_restore(state);
+    thread_yield_higher();
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_schedtrace
+ * @{
+ *
+ * @file
+ * @brief       Scheduler trace ring buffer and export
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "schedtrace.h"
+#include "irq.h"
+#include "msg.h"
+#include "sched.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifdef MODULE_VFS
+#include <fcntl.h>
+#include "vfs.h"
+#endif
+
+#if (SCHEDTRACE_SIZE & (SCHEDTRACE_SIZE - 1)) != 0
+#error "SCHEDTRACE_SIZE must be a power of two"
+#endif
+
+static schedtrace_event_t _events[SCHEDTRACE_SIZE];
+/* number of written slots, (UINT_MAX + 1) is a multiple of SCHEDTRACE_SIZE so
+ * the slot index stays continuous when this wraps around */
+static volatile unsigned _head = 0;
+static volatile bool _enabled = true;
+
+void schedtrace_add(schedtrace_type_t type, kernel_pid_t pid, uint16_t arg)
+{
+    /* a record is written as a whole with interrupts disabled, and
+     * schedtrace_export() clears _enabled with interrupts disabled, so no
+     * record can change or be half-written while it is exported */
+    unsigned state = irq_disable();
+
+    if (_enabled) {
+        schedtrace_event_t *e = &_events[_head++ & (SCHEDTRACE_SIZE - 1)];
+
+        e->time = _xtimer_now();
+        e->type = type;
+        e->pid = pid;
+        e->arg = arg;
+    }
+    irq_restore(state);
+}
+
+void schedtrace_enable(bool enable)
+{
+    _enabled = enable;
+}
+
+void schedtrace_clear(void)
+{
+    _head = 0;
+}
+
+unsigned schedtrace_numof(void)
+{
+    unsigned head = _head;
+
+    return (head < SCHEDTRACE_SIZE) ? head : SCHEDTRACE_SIZE;
+}
+
+int schedtrace_export(schedtrace_write_t write, void *arg)
+{
+    schedtrace_hdr_t hdr;
+    unsigned state = irq_disable();
+    bool enabled = _enabled;
+    unsigned head = _head;
+    int res;
+
+    _enabled = false;
+    irq_restore(state);
+
+    unsigned numof = (head < SCHEDTRACE_SIZE) ? head : SCHEDTRACE_SIZE;
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = SCHEDTRACE_MAGIC;
+    hdr.version = SCHEDTRACE_VERSION;
+    hdr.event_size = sizeof(schedtrace_event_t);
+    hdr.numof = numof;
+    hdr.hz = XTIMER_HZ;
+    hdr.isr_pid = KERNEL_PID_ISR;
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (sched_threads[pid] != NULL) {
+            hdr.threads++;
+        }
+    }
+    if ((res = write(&hdr, sizeof(hdr), arg)) < 0) {
+        goto out;
+    }
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (sched_threads[pid] == NULL) {
+            continue;
+        }
+#ifdef DEVELHELP
+        const char *name = thread_getname(pid);
+#else
+        const char *name = NULL;
+#endif
+        uint8_t entry[2] = { pid, name ? strlen(name) : 0 };
+
+        if (((res = write(entry, sizeof(entry), arg)) < 0) ||
+            (entry[1] && ((res = write(name, entry[1], arg)) < 0))) {
+            goto out;
+        }
+    }
+
+    for (unsigned i = head - numof; i != head; i++) {
+        if ((res = write(&_events[i & (SCHEDTRACE_SIZE - 1)],
+                         sizeof(schedtrace_event_t), arg)) < 0) {
+            goto out;
+        }
+    }
+    res = numof;
+
+out:
+    _enabled = enabled;
+    return res;
+}
+
+#ifdef MODULE_VFS
+static int _vfs_write(const void *data, size_t len, void *arg)
+{
+    int fd = *((int *)arg);
+    ssize_t res = vfs_write(fd, data, len);
+
+    return (res < 0) ? res : 0;
+}
+
+int schedtrace_save(const char *path)
+{
+    int fd = vfs_open(path, O_CREAT | O_TRUNC | O_WRONLY, 0);
+    if (fd < 0) {
+        return fd;
+    }
+
+    int res = schedtrace_export(_vfs_write, &fd);
+    int close_res = vfs_close(fd);
+
+    return (res < 0) ? res : ((close_res < 0) ? close_res : res);
+}
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell commands for the scheduler trace
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "schedtrace.h"
+
+#define BYTES_PER_LINE  (32U)
+
+static int _print_hex(const void *data, size_t len, void *arg)
+{
+    const uint8_t *bytes = data;
+    unsigned *col = arg;
+
+    for (size_t i = 0; i < len; i++) {
+        printf("%02x", bytes[i]);
+        if (++(*col) == BYTES_PER_LINE) {
+            puts("");
+            *col = 0;
+        }
+    }
+    return 0;
+}
+
+static void _usage(const char *cmd)
+{
+#ifdef MODULE_VFS
+    printf("usage: %s [dump|save <path>|clear|start|stop]\n", cmd);
+#else
+    printf("usage: %s [dump|clear|start|stop]\n", cmd);
+#endif
+}
+
+int _schedtrace_handler(int argc, char **argv)
+{
+    if ((argc < 2) || (strcmp(argv[1], "dump") == 0)) {
+        unsigned col = 0;
+
+        puts("schedtrace: begin");
+        int res = schedtrace_export(_print_hex, &col);
+        if (col) {
+            puts("");
+        }
+        printf("schedtrace: end (%d events)\n", res);
+    }
+#ifdef MODULE_VFS
+    else if ((strcmp(argv[1], "save") == 0) && (argc > 2)) {
+        int res = schedtrace_save(argv[2]);
+        if (res < 0) {
+            printf("error: unable to write %s (%d)\n", argv[2], res);
+            return 1;
+        }
+        printf("wrote %d events to %s\n", res, argv[2]);
+    }
+#endif
+    else if (strcmp(argv[1], "clear") == 0) {
+        schedtrace_clear();
+    }
+    else if (strcmp(argv[1], "start") == 0) {
+        schedtrace_enable(true);
+    }
+    else if (strcmp(argv[1], "stop") == 0) {
+        schedtrace_enable(false);
+    }
+    else {
+        _usage(argv[0]);
+        return 1;
+    }
+    return 0;
+}
@@ -132,6 +132,10 @@ extern int _vfs_handler(int argc, char **argv);
 extern int _ls_handler(int argc, char **argv);
 #endif
 
+#ifdef MODULE_SCHEDTRACE
+extern int _schedtrace_handler(int argc, char **argv);
+#endif
+
 const shell_command_t _shell_command_list[] = {
     {"reboot", "Reboot the node", _reboot_handler},
 #ifdef MODULE_CONFIG
@@ -220,6 +224,9 @@ const shell_command_t _shell_command_list[] = {
 #ifdef MODULE_VFS
     {"vfs", "virtual file system operations", _vfs_handler},
     {"ls", "list files", _ls_handler},
+#endif
+#ifdef MODULE_SCHEDTRACE
+    {"schedtrace", "dump or control the scheduler trace", _schedtrace_handler},
 #endif
     {NULL, NULL, NULL}
 };
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_spscrb
+ * @{
+ *
+ * @file
+ * @brief       Single-producer single-consumer ringbuffer implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "spscrb.h"
+
+/* the counters run freely, UINT_MAX + 1 is a multiple of the power of two
+ * size, so masking them stays correct when they wrap around */
+static inline unsigned _idx(const spscrb_t *rb, unsigned pos)
+{
+    return pos & (rb->size - 1);
+}
+
+int spscrb_add_one(spscrb_t *rb, uint8_t c)
+{
+    unsigned writes = atomic_load_explicit(&rb->writes, memory_order_relaxed);
+
+    if ((writes - atomic_load_explicit(&rb->reads, memory_order_acquire))
+        == rb->size) {
+        return -1;
+    }
+    rb->buf[_idx(rb, writes)] = c;
+    atomic_store_explicit(&rb->writes, writes + 1, memory_order_release);
+    return 0;
+}
+
+size_t spscrb_add(spscrb_t *rb, const void *src, size_t n)
+{
+    unsigned writes = atomic_load_explicit(&rb->writes, memory_order_relaxed);
+    unsigned space = rb->size -
+                     (writes - atomic_load_explicit(&rb->reads,
+                                                    memory_order_acquire));
+
+    if (n > space) {
+        n = space;
+    }
+
+    unsigned pos = _idx(rb, writes);
+    size_t first = rb->size - pos;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(rb->buf + pos, src, first);
+    memcpy(rb->buf, (const uint8_t *)src + first, n - first);
+
+    atomic_store_explicit(&rb->writes, writes + n, memory_order_release);
+    return n;
+}
+
+int spscrb_get_one(spscrb_t *rb)
+{
+    unsigned reads = atomic_load_explicit(&rb->reads, memory_order_relaxed);
+
+    if (atomic_load_explicit(&rb->writes, memory_order_acquire) == reads) {
+        return -1;
+    }
+    int c = rb->buf[_idx(rb, reads)];
+    atomic_store_explicit(&rb->reads, reads + 1, memory_order_release);
+    return c;
+}
+
+size_t spscrb_get(spscrb_t *rb, void *dst, size_t n)
+{
+    unsigned reads = atomic_load_explicit(&rb->reads, memory_order_relaxed);
+    unsigned avail = atomic_load_explicit(&rb->writes, memory_order_acquire) -
+                     reads;
+
+    if (n > avail) {
+        n = avail;
+    }
+
+    unsigned pos = _idx(rb, reads);
+    size_t first = rb->size - pos;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(dst, rb->buf + pos, first);
+    memcpy((uint8_t *)dst + first, rb->buf, n - first);
+
+    atomic_store_explicit(&rb->reads, reads + n, memory_order_release);
+    return n;
+}
+
+size_t spscrb_peek_span(spscrb_t *rb, const uint8_t **span)
+{
+    unsigned reads = atomic_load_explicit(&rb->reads, memory_order_relaxed);
+    size_t avail = atomic_load_explicit(&rb->writes, memory_order_acquire) -
+                   reads;
+    unsigned pos = _idx(rb, reads);
+
+    *span = rb->buf + pos;
+    return (avail < (rb->size - pos)) ? avail : (rb->size - pos);
+}
+
+void spscrb_consume(spscrb_t *rb, size_t n)
+{
+    unsigned reads = atomic_load_explicit(&rb->reads, memory_order_relaxed);
+
+    assert(n <= (atomic_load_explicit(&rb->writes, memory_order_relaxed) -
+                 reads));
+    atomic_store_explicit(&rb->reads, reads + n, memory_order_release);
+}
+
+size_t spscrb_reserve_span(spscrb_t *rb, uint8_t **span)
+{
+    unsigned writes = atomic_load_explicit(&rb->writes, memory_order_relaxed);
+    size_t space = rb->size -
+                   (writes - atomic_load_explicit(&rb->reads,
+                                                  memory_order_acquire));
+    unsigned pos = _idx(rb, writes);
+
+    *span = rb->buf + pos;
+    return (space < (rb->size - pos)) ? space : (rb->size - pos);
+}
+
+void spscrb_commit(spscrb_t *rb, size_t n)
+{
+    unsigned writes = atomic_load_explicit(&rb->writes, memory_order_relaxed);
+
+    assert(n <= (rb->size - (writes - atomic_load_explicit(&rb->reads,
+                                                           memory_order_relaxed))));
+    atomic_store_explicit(&rb->writes, writes + n, memory_order_release);
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_threadstat
+ * @{
+ *
+ * @file
+ * @brief       Thread statistics sampling
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+#include "threadstat.h"
+#include "xtimer.h"
+
+/* loads are kept in 1/100 percent with this many fractional bits, so the
+ * slow averages don't get stuck on rounding errors */
+#define FRAC_BITS       (8U)
+#define LOAD_MAX        (10000UL << FRAC_BITS)
+
+typedef struct {
+    const thread_t *thread;     /* thread the entry belongs to */
+    uint32_t runtime;           /* runtime at the last sample */
+    uint32_t load[THREADSTAT_LOAD_NUMOF];
+#ifdef DEVELHELP
+    uintptr_t *hwm;             /* lowest stack word known to be used */
+#endif
+} _stat_t;
+
+/* inverse weight of a new sample, 1 just keeps the last one */
+static const uint8_t _weight[THREADSTAT_LOAD_NUMOF] = { 1, 10, 60 };
+
+static _stat_t _stats[KERNEL_PID_LAST + 1];
+static uint32_t _cpu[THREADSTAT_LOAD_NUMOF];
+static uint32_t _last;
+static xtimer_t _timer;
+
+static uint32_t _runtime(const thread_t *thread, uint32_t now)
+{
+    const schedstat *stat = &sched_pidlist[thread->pid];
+    uint32_t runtime = stat->runtime_ticks;
+
+    /* the interrupted thread was not accounted for since it started */
+    if ((thread == (thread_t *)sched_active_thread) && stat->laststart) {
+        runtime += now - stat->laststart;
+    }
+    return runtime;
+}
+
+/* exponential moving averages, not averages over a window of samples */
+static void _average(uint32_t *load, uint32_t sample)
+{
+    for (unsigned i = 0; i < THREADSTAT_LOAD_NUMOF; i++) {
+        load[i] += ((int32_t)sample - (int32_t)load[i]) / _weight[i];
+    }
+}
+
+#ifdef DEVELHELP
+static void _scan_stack(_stat_t *stat)
+{
+    uintptr_t *bottom = (uintptr_t *)stat->thread->stack_start;
+    uintptr_t *p = stat->hwm;
+    unsigned gap = 0;
+
+    while ((p > bottom) && (gap < THREADSTAT_STACK_GAP)) {
+        p--;
+        if (*p == (uintptr_t)p) {
+            gap++;
+        }
+        else {
+            gap = 0;
+            stat->hwm = p;
+        }
+    }
+}
+#endif
+
+static void _sample(void *arg)
+{
+    (void)arg;
+
+    uint32_t now = _xtimer_now();
+    uint32_t elapsed = now - _last;
+    bool idle_sampled = false;
+    uint32_t idle = 0;
+
+    _last = now;
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        const thread_t *thread = (thread_t *)sched_threads[pid];
+        _stat_t *stat = &_stats[pid];
+
+        if (thread == NULL) {
+            stat->thread = NULL;
+            continue;
+        }
+
+        uint32_t runtime = _runtime(thread, now);
+
+        if (thread != stat->thread) {
+            /* new thread, start with an empty record */
+            memset(stat, 0, sizeof(*stat));
+            stat->thread = thread;
+#ifdef DEVELHELP
+            /* the thread control block sits at the top of the stack */
+            stat->hwm = (uintptr_t *)thread;
+#endif
+        }
+        else if (elapsed) {
+            uint64_t sample = ((uint64_t)(runtime - stat->runtime) * LOAD_MAX)
+                              / elapsed;
+
+            if (sample > LOAD_MAX) {
+                sample = LOAD_MAX;
+            }
+            _average(stat->load, sample);
+            if (thread->priority == THREAD_PRIORITY_IDLE) {
+                idle = sample;
+                idle_sampled = true;
+            }
+        }
+        stat->runtime = runtime;
+
+#ifdef DEVELHELP
+        _scan_stack(stat);
+#endif
+    }
+
+    /* everything the idle thread did not get, including interrupts */
+    if (idle_sampled) {
+        _average(_cpu, LOAD_MAX - idle);
+    }
+
+    xtimer_set(&_timer, THREADSTAT_INTERVAL);
+}
+
+void threadstat_init(void)
+{
+    unsigned state = irq_disable();
+
+    _timer.callback = _sample;
+    _last = _xtimer_now();
+    _sample(NULL);
+
+    irq_restore(state);
+}
+
+int threadstat_get(kernel_pid_t pid, threadstat_t *stat)
+{
+    if (!pid_is_valid(pid)) {
+        return -ENOENT;
+    }
+
+    unsigned state = irq_disable();
+    const _stat_t *entry = &_stats[pid];
+
+    if ((entry->thread == NULL) || (entry->thread != sched_threads[pid])) {
+        irq_restore(state);
+        return -ENOENT;
+    }
+
+    for (unsigned i = 0; i < THREADSTAT_LOAD_NUMOF; i++) {
+        stat->load[i] = entry->load[i] >> FRAC_BITS;
+    }
+#ifdef DEVELHELP
+    stat->stack_size = entry->thread->stack_size;
+    stat->stack_used = entry->thread->stack_size -
+                       ((char *)entry->hwm - entry->thread->stack_start);
+#else
+    stat->stack_size = 0;
+    stat->stack_used = 0;
+#endif
+
+    irq_restore(state);
+
+    return 0;
+}
+
+void threadstat_cpu(uint16_t load[THREADSTAT_LOAD_NUMOF])
+{
+    unsigned state = irq_disable();
+
+    for (unsigned i = 0; i < THREADSTAT_LOAD_NUMOF; i++) {
+        load[i] = _cpu[i] >> FRAC_BITS;
+    }
+
+    irq_restore(state);
+}
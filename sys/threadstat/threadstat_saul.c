@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_threadstat
+ * @{
+ *
+ * @file
+ * @brief       SAUL adaption for the total CPU load
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#ifdef MODULE_SAUL
+
+#include "saul.h"
+#include "threadstat.h"
+
+static int _read(void *dev, phydat_t *res)
+{
+    (void)dev;
+
+    uint16_t load[THREADSTAT_LOAD_NUMOF];
+
+    threadstat_cpu(load);
+    for (unsigned i = 0; i < THREADSTAT_LOAD_NUMOF; i++) {
+        res->val[i] = load[i];
+    }
+    res->unit = UNIT_PERCENT;
+    res->scale = -2;
+
+    return THREADSTAT_LOAD_NUMOF;
+}
+
+const saul_driver_t threadstat_saul_driver = {
+    .read = _read,
+    .write = saul_notsup,
+    .type = SAUL_SENSE_CPU,
+};
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_SAUL */
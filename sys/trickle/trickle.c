@@ -32,9 +32,20 @@ void trickle_callback(trickle_t *trickle)
     }
 }
 
+static uint32_t _slack(uint64_t window)
+{
+#if TRICKLE_SLACK_DIV
+    window /= TRICKLE_SLACK_DIV;
+    return (window > UINT32_MAX) ? UINT32_MAX : (uint32_t)window;
+#else
+    (void)window;
+    return 0;
+#endif
+}
+
 void trickle_interval(trickle_t *trickle)
 {
-    uint32_t max_interval;
+    uint32_t max_interval, slack;
 
     trickle->I = trickle->I * 2;
     max_interval = trickle->Imin << trickle->Imax;
@@ -49,12 +60,19 @@ void trickle_interval(trickle_t *trickle)
     trickle->t = (trickle->I / 2) + random_uint32_range(0, (trickle->I / 2) + 1);
 
     trickle->msg_callback_time = trickle->t * MS_PER_SEC;
-    xtimer_set_msg64(&trickle->msg_callback_timer, trickle->msg_callback_time,
-                     &trickle->msg_callback, trickle->pid);
-
     trickle->msg_interval_time = trickle->I * MS_PER_SEC;
-    xtimer_set_msg64(&trickle->msg_interval_timer, trickle->msg_interval_time,
-                     &trickle->msg_interval, trickle->pid);
+    slack = _slack(trickle->msg_interval_time);
+
+    /* the callback must not be delayed into the next interval */
+    if (slack > ((uint64_t)(trickle->I - trickle->t) * MS_PER_SEC)) {
+        slack = (trickle->I - trickle->t) * MS_PER_SEC;
+    }
+    xtimer_set_msg64_with_slack(&trickle->msg_callback_timer, trickle->msg_callback_time,
+                                slack, &trickle->msg_callback, trickle->pid);
+
+    xtimer_set_msg64_with_slack(&trickle->msg_interval_timer, trickle->msg_interval_time,
+                                _slack(trickle->msg_interval_time),
+                                &trickle->msg_interval, trickle->pid);
 }
 
 void trickle_reset_timer(trickle_t *trickle)
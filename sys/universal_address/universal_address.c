@@ -46,6 +46,13 @@
 #   define UNIVERSAL_ADDRESS_MAX_ENTRIES    (UA_ADD0)
 #endif
 
+/**
+ * @brief Number of buckets of the hash index
+ */
+#ifndef UNIVERSAL_ADDRESS_HASH_BUCKETS
+#   define UNIVERSAL_ADDRESS_HASH_BUCKETS   ((UNIVERSAL_ADDRESS_MAX_ENTRIES / 2) + 1)
+#endif
+
 /**
  * @brief counter indicating the number of entries allocated
  */
@@ -56,11 +63,53 @@ static size_t universal_address_table_filled = 0;
  */
 static universal_address_container_t universal_address_table[UNIVERSAL_ADDRESS_MAX_ENTRIES];
 
+/**
+ * @brief number of containers of universal_address_table that have been
+ *        handed out at least once
+ */
+static size_t universal_address_table_used = 0;
+
+/**
+ * @brief heads of the hash bucket lists (index + 1, 0 for an empty list)
+ */
+static uint16_t universal_address_buckets[UNIVERSAL_ADDRESS_HASH_BUCKETS];
+
+/**
+ * @brief head of the list of removed containers (index + 1, 0 for an empty
+ *        list)
+ */
+static uint16_t universal_address_free = 0;
+
 /**
  * @brief access mutex to control exclusive operations on calls
  */
 static mutex_t mtx_access = MUTEX_INIT;
 
+static inline universal_address_container_t *_entry(uint16_t idx)
+{
+    return (idx == 0) ? NULL : &universal_address_table[idx - 1];
+}
+
+static inline uint16_t _idx(universal_address_container_t *entry)
+{
+    return (uint16_t)(entry - universal_address_table) + 1;
+}
+
+/**
+ * @brief returns the hash bucket list for the given address
+ */
+static uint16_t *_bucket(const uint8_t *addr, size_t addr_size)
+{
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
+
+    hash = (hash ^ addr_size) * 16777619U;
+    for (size_t i = 0; i < addr_size; i++) {
+        hash = (hash ^ addr[i]) * 16777619U;
+    }
+    return &universal_address_buckets[hash % UNIVERSAL_ADDRESS_HASH_BUCKETS];
+}
+
 /**
  * @brief finds the universal address container for the given address
  *
@@ -72,38 +121,48 @@ static mutex_t mtx_access = MUTEX_INIT;
  */
 static universal_address_container_t *universal_address_find_entry(uint8_t *addr, size_t addr_size)
 {
-    for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-        if (universal_address_table[i].address_size == addr_size) {
-            if (memcmp((universal_address_table[i].address), addr, addr_size) == 0) {
-                return &(universal_address_table[i]);
-            }
+    universal_address_container_t *entry = _entry(*_bucket(addr, addr_size));
+
+    while (entry != NULL) {
+        if ((entry->address_size == addr_size) &&
+            (memcmp(entry->address, addr, addr_size) == 0)) {
+            return entry;
         }
+        entry = _entry(entry->next);
     }
 
     return NULL;
 }
 
 /**
- * @brief finds the next empty or unused universal address containers
+ * @brief gets an unused universal address container
+ *
+ * Removed containers are reused first. The address data lives in the
+ * container itself, so it never moves while the container is in use.
  *
  * @return pointer to the next free/unused universal_address_container_t
  *         or NULL if no memory is left in universal_address_table
  */
 static universal_address_container_t *universal_address_get_next_unused_entry(void)
 {
-    if (universal_address_table_filled < UNIVERSAL_ADDRESS_MAX_ENTRIES) {
-        for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-            if (universal_address_table[i].use_count == 0) {
-                return &(universal_address_table[i]);
-            }
-        }
+    universal_address_container_t *entry = _entry(universal_address_free);
+
+    if (entry != NULL) {
+        universal_address_free = entry->next;
+    }
+    else if (universal_address_table_used < UNIVERSAL_ADDRESS_MAX_ENTRIES) {
+        entry = &universal_address_table[universal_address_table_used++];
     }
 
-    return NULL;
+    return entry;
 }
 
 universal_address_container_t *universal_address_add(uint8_t *addr, size_t addr_size)
 {
+    if ((addr_size == 0) || (addr_size > UNIVERSAL_ADDRESS_SIZE)) {
+        return NULL;
+    }
+
     mutex_lock(&mtx_access);
     universal_address_container_t *pEntry = universal_address_find_entry(addr, addr_size);
 
@@ -117,18 +176,15 @@ universal_address_container_t *universal_address_add(uint8_t *addr, size_t addr_
             return NULL;
         }
 
-        /* look if the former memory has distinct size */
-        if (pEntry->address_size != addr_size) {
-            /* clean the address */
-            memset(pEntry->address, 0, UNIVERSAL_ADDRESS_SIZE);
-
-            /* set the used bytes */
-            pEntry->address_size = addr_size;
-            pEntry->use_count = 0;
-        }
-
         /* copy the address */
         memcpy((pEntry->address), addr, addr_size);
+        pEntry->address_size = addr_size;
+        pEntry->use_count = 0;
+
+        /* add it to the hash index */
+        uint16_t *bucket = _bucket(addr, addr_size);
+        pEntry->next = *bucket;
+        *bucket = _idx(pEntry);
     }
 
     pEntry->use_count++;
@@ -148,12 +204,24 @@ void universal_address_rem(universal_address_container_t *entry)
     mutex_lock(&mtx_access);
     DEBUG("[universal_address_rem] entry: %p\n", (void *)entry);
 
-    /* we do not delete anything on remove */
     if (entry != NULL) {
         if (entry->use_count != 0) {
             entry->use_count--;
 
             if (entry->use_count == 0) {
+                /* remove it from the hash index and keep it for reuse */
+                uint16_t *link = _bucket(entry->address, entry->address_size);
+                uint16_t idx = _idx(entry);
+
+                while ((*link != 0) && (*link != idx)) {
+                    link = &_entry(*link)->next;
+                }
+                if (*link == idx) {
+                    *link = entry->next;
+                }
+                entry->address_size = 0;
+                entry->next = universal_address_free;
+                universal_address_free = idx;
                 universal_address_table_filled--;
             }
         }
@@ -290,28 +358,29 @@ int universal_address_compare_prefix(universal_address_container_t *entry,
     return ret;
 }
 
+/**
+ * @brief drops all containers and their memory
+ */
+static void _clear(void)
+{
+    memset(universal_address_table, 0, sizeof(universal_address_table));
+    memset(universal_address_buckets, 0, sizeof(universal_address_buckets));
+    universal_address_free = 0;
+    universal_address_table_used = 0;
+    universal_address_table_filled = 0;
+}
+
 void universal_address_init(void)
 {
     mutex_lock(&mtx_access);
-
-    for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-        universal_address_table[i].use_count = 0;
-        universal_address_table[i].address_size = 0;
-        memset(universal_address_table[i].address, 0, UNIVERSAL_ADDRESS_SIZE);
-    }
-
+    _clear();
     mutex_unlock(&mtx_access);
 }
 
 void universal_address_reset(void)
 {
     mutex_lock(&mtx_access);
-
-    for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-        universal_address_table[i].use_count = 0;
-    }
-
-    universal_address_table_filled = 0;
+    _clear();
     mutex_unlock(&mtx_access);
 }
 
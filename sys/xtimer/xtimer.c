@@ -157,6 +157,50 @@ void _xtimer_set_msg64(xtimer_t *timer, uint64_t offset, msg_t *msg, kernel_pid_
     _xtimer_set64(timer, offset, offset >> 32);
 }
 
+void _xtimer_set64_with_slack(xtimer_t *timer, uint64_t offset, uint32_t slack)
+{
+    if (slack) {
+        /* Round to the tick within [now + offset, now + offset + slack]
+         * with the most trailing zero bits. Timers only share that tick if
+         * it lies in both of their windows; overlapping windows are not
+         * merged otherwise. */
+        uint64_t now = _xtimer_now64();
+        uint64_t target = now + offset;
+        uint64_t limit = target + slack;
+        uint64_t mask = target ^ limit;
+
+        if (mask) {
+            unsigned bit = 63;
+            while (!(mask & (1ULL << bit))) {
+                bit--;
+            }
+            target = limit & ~((1ULL << bit) - 1);
+        }
+        /* account for the time it took to get here */
+        now = _xtimer_now64();
+        offset = (target > now) ? (target - now) : 0;
+    }
+    _xtimer_set64(timer, offset, offset >> 32);
+}
+
+void _xtimer_set_msg64_with_slack(xtimer_t *timer, uint64_t offset, uint32_t slack,
+                                  msg_t *msg, kernel_pid_t target_pid)
+{
+    _setup_msg(timer, msg, target_pid);
+    _xtimer_set64_with_slack(timer, offset, slack);
+}
+
+#ifdef MODULE_XTIMER_STATS
+xtimer_stats_t _xtimer_stats;
+
+void xtimer_get_stats(xtimer_stats_t *stats)
+{
+    unsigned state = irq_disable();
+    *stats = _xtimer_stats;
+    irq_restore(state);
+}
+#endif
+
 static void _callback_wakeup(void* arg)
 {
     thread_wakeup((kernel_pid_t)((intptr_t)arg));
@@ -232,14 +276,12 @@ static void _mutex_timeout(void *arg)
 {
     mutex_thread_t *mt = (mutex_thread_t *)arg;
 
-    mt->timeout = 1;
-    list_node_t *node = list_remove(&mt->mutex->queue,
-                                    (list_node_t *)&mt->thread->rq_entry);
-    if ((node != NULL) && (mt->mutex->queue.next == NULL)) {
-        mt->mutex->queue.next = MUTEX_LOCKED;
+    /* the thread may have got the mutex right before the timer fired */
+    if (mutex_cancel_wait(mt->mutex, mt->thread->pid)) {
+        mt->timeout = 1;
+        sched_set_status(mt->thread, STATUS_PENDING);
+        thread_yield_higher();
     }
-    sched_set_status(mt->thread, STATUS_PENDING);
-    thread_yield_higher();
 }
 
 int xtimer_mutex_lock_timeout(mutex_t *mutex, uint64_t timeout)
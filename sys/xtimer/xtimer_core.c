@@ -432,6 +432,9 @@ static void _timer_callback(void)
 {
     uint32_t next_target;
     uint32_t reference;
+#ifdef MODULE_XTIMER_STATS
+    unsigned shots = 0;
+#endif
 
     _in_handler = 1;
 
@@ -479,6 +482,12 @@ overflow:
         timer->long_target = 0;
 
         /* fire timer */
+#ifdef MODULE_XTIMER_STATS
+        _xtimer_stats.fired++;
+        if (shots++) {
+            _xtimer_stats.saved++;
+        }
+#endif
         _shoot(timer);
     }
 
@@ -0,0 +1,634 @@
+/**
+ * Copyright (C) 2015 Kaspar Schleiser <kaspar@schleiser.de>
+ * Copyright (C) 2016 Eistec AB
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ *
+ * @ingroup xtimer
+ * @{
+ * @file
+ * @brief xtimer core functionality based on a hierarchical timing wheel
+ *
+ * Timers are kept in XTIMER_WHEEL_LEVELS levels of XTIMER_WHEEL_SLOTS slots.
+ * A slot of level 0 covers 2^XTIMER_WHEEL_SHIFT ticks, each following level
+ * covers XTIMER_WHEEL_SLOTS times the range of the previous one. Slots are
+ * unsorted lists, so adding a timer is O(1). Only the timers of the current
+ * level 0 slot are kept sorted in the "near" list, from which they are fired
+ * with the same accuracy as with the list based implementation. Whenever
+ * time advances into a slot of a higher level, its timers are redistributed
+ * to the lower levels ("cascading").
+ *
+ * The low-level timer is only set for the next timer in the near list and for
+ * the next non-empty slot, empty slots are skipped using a bitmap per level.
+ *
+ * @author Kaspar Schleiser <kaspar@schleiser.de>
+ * @author Joakim Nohlgård <joakim.nohlgard@eistec.se>
+ * @author agent <agent@local>
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "board.h"
+#include "periph/timer.h"
+#include "periph_conf.h"
+
+#include "bitarithm.h"
+#include "xtimer.h"
+#include "irq.h"
+
+/* WARNING! enabling this will have side effects and can lead to timer underflows. */
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   number of bits of a slot index
+ */
+#define XTIMER_WHEEL_SLOT_BITS      (5U)
+
+/**
+ * @brief   number of slots per level
+ */
+#define XTIMER_WHEEL_SLOTS          (1U << XTIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief   number of ticks of one low-level timer period
+ */
+#define XTIMER_PERIOD               ((uint64_t)((uint32_t)~XTIMER_MASK) + 1)
+
+#if (XTIMER_WHEEL_SLACK & (XTIMER_WHEEL_SLACK - 1))
+#error "XTIMER_WHEEL_SLACK must be 0 or a power of two"
+#endif
+
+static volatile int _in_handler = 0;
+
+static volatile uint32_t _long_cnt = 0;
+#if XTIMER_MASK
+volatile uint32_t _xtimer_high_cnt = 0;
+#endif
+
+/**
+ * @brief   timers expiring in the current level 0 slot, sorted by target
+ */
+static xtimer_t *_near = NULL;
+
+/**
+ * @brief   timers that are too far in the future for the wheel
+ */
+static xtimer_t *_far = NULL;
+
+/**
+ * @brief   the wheel itself
+ */
+static xtimer_t *_wheel[XTIMER_WHEEL_LEVELS][XTIMER_WHEEL_SLOTS];
+
+/**
+ * @brief   bitmaps of the non-empty slots of each level
+ */
+static uint32_t _used[XTIMER_WHEEL_LEVELS];
+
+/**
+ * @brief   the current level 0 slot, counted in 2^XTIMER_WHEEL_SHIFT ticks
+ *          since boot
+ */
+static uint64_t _current = 0;
+
+/**
+ * @brief   64 bit time the low-level timer is set to
+ */
+static uint64_t _next_event = 0;
+
+/**
+ * @brief   the low-level timer is set to the end of the current period
+ */
+static int _next_is_period_end = 0;
+
+static void _timer_callback(void);
+static void _periph_timer_callback(void *arg, int chan);
+
+static inline int _is_set(xtimer_t *timer)
+{
+    return (timer->target || timer->long_target);
+}
+
+static inline uint64_t _target(xtimer_t *timer)
+{
+    return ((uint64_t)timer->long_target << 32) | timer->target;
+}
+
+static inline uint64_t _period_start(void)
+{
+#if XTIMER_MASK
+    return ((uint64_t)_long_cnt << 32) | _xtimer_high_cnt;
+#else
+    return ((uint64_t)_long_cnt << 32);
+#endif
+}
+
+static inline unsigned _level_shift(unsigned level)
+{
+    return level * XTIMER_WHEEL_SLOT_BITS;
+}
+
+static inline unsigned _first_slot(uint32_t used)
+{
+    /* bitarithm_lsb() takes an unsigned, which might only be 16 bit wide */
+    if (used & 0xffff) {
+        return bitarithm_lsb(used & 0xffff);
+    }
+    return 16 + bitarithm_lsb(used >> 16);
+}
+
+static inline void xtimer_spin_until(uint32_t target) {
+#if XTIMER_MASK
+    target = _xtimer_lltimer_mask(target);
+#endif
+    while (_xtimer_lltimer_now() > target);
+    while (_xtimer_lltimer_now() < target);
+}
+
+void xtimer_init(void)
+{
+    /* initialize low-level timer */
+    timer_init(XTIMER_DEV, XTIMER_HZ, _periph_timer_callback, NULL);
+
+    /* register initial overflow tick */
+    _next_event = XTIMER_PERIOD - 1;
+    _next_is_period_end = 1;
+    timer_set_absolute(XTIMER_DEV, XTIMER_CHAN, _xtimer_lltimer_mask(0xFFFFFFFF));
+}
+
+static void _xtimer_now_internal(uint32_t *short_term, uint32_t *long_term)
+{
+    uint32_t before, after, long_value;
+
+    /* loop to cope with possible overflow of _xtimer_now() */
+    do {
+        before = _xtimer_now();
+        long_value = _long_cnt;
+        after = _xtimer_now();
+
+    } while(before > after);
+
+    *short_term = after;
+    *long_term = long_value;
+}
+
+uint64_t _xtimer_now64(void)
+{
+    uint32_t short_term, long_term;
+    _xtimer_now_internal(&short_term, &long_term);
+
+    return ((uint64_t)long_term<<32) + short_term;
+}
+
+static void _shoot(xtimer_t *timer)
+{
+    timer->callback(timer->arg);
+}
+
+/**
+ * @brief   put a timer into the near list, the wheel or the far list,
+ *          depending on its distance to the current slot
+ */
+static void _insert(xtimer_t *timer)
+{
+    uint64_t target = _target(timer);
+    uint64_t slot = target >> XTIMER_WHEEL_SHIFT;
+
+    if (slot <= _current) {
+        xtimer_t **pos = &_near;
+
+        while (*pos && (_target(*pos) <= target)) {
+            pos = &((*pos)->next);
+        }
+        timer->next = *pos;
+        *pos = timer;
+        return;
+    }
+
+    for (unsigned level = 0; level < XTIMER_WHEEL_LEVELS; level++) {
+        unsigned shift = _level_shift(level + 1);
+
+        if ((slot >> shift) == (_current >> shift)) {
+            unsigned idx = (slot >> _level_shift(level)) & (XTIMER_WHEEL_SLOTS - 1);
+
+            timer->next = _wheel[level][idx];
+            _wheel[level][idx] = timer;
+            _used[level] |= (1UL << idx);
+            return;
+        }
+    }
+
+    timer->next = _far;
+    _far = timer;
+}
+
+static int _remove_timer_from_list(xtimer_t **list_head, xtimer_t *timer)
+{
+    while (*list_head) {
+        if (*list_head == timer) {
+            *list_head = timer->next;
+            return 1;
+        }
+        list_head = &((*list_head)->next);
+    }
+
+    return 0;
+}
+
+static void _remove(xtimer_t *timer)
+{
+    /* the slot a timer is kept in only depends on its target, so just the
+     * list it is supposed to be in has to be searched */
+    uint64_t slot = _target(timer) >> XTIMER_WHEEL_SHIFT;
+
+    if (slot <= _current) {
+        _remove_timer_from_list(&_near, timer);
+        return;
+    }
+
+    for (unsigned level = 0; level < XTIMER_WHEEL_LEVELS; level++) {
+        unsigned shift = _level_shift(level + 1);
+
+        if ((slot >> shift) == (_current >> shift)) {
+            unsigned idx = (slot >> _level_shift(level)) & (XTIMER_WHEEL_SLOTS - 1);
+
+            _remove_timer_from_list(&_wheel[level][idx], timer);
+            if (!_wheel[level][idx]) {
+                _used[level] &= ~(1UL << idx);
+            }
+            return;
+        }
+    }
+
+    _remove_timer_from_list(&_far, timer);
+}
+
+/**
+ * @brief   find the next slot that has to be processed
+ *
+ * @return  the slot number, counted like _current
+ * @return  UINT64_MAX if the wheel is empty
+ */
+static uint64_t _next_slot(void)
+{
+    for (unsigned level = 0; level < XTIMER_WHEEL_LEVELS; level++) {
+        if (_used[level]) {
+            unsigned shift = _level_shift(level + 1);
+            uint64_t base = (_current >> shift) << shift;
+
+            return base | ((uint64_t)_first_slot(_used[level]) << _level_shift(level));
+        }
+    }
+    if (_far) {
+        unsigned shift = _level_shift(XTIMER_WHEEL_LEVELS);
+        return ((_current >> shift) + 1) << shift;
+    }
+    return UINT64_MAX;
+}
+
+/**
+ * @brief   move the wheel forward, so that all timers expiring up to @p time
+ *          are in the near list
+ */
+static void _advance(uint64_t time)
+{
+    uint64_t slot = time >> XTIMER_WHEEL_SHIFT;
+
+    while (_current < slot) {
+        uint64_t next = _next_slot();
+
+        if (next > slot) {
+            /* all slots in between are empty */
+            _current = slot;
+            return;
+        }
+
+        _current = next;
+
+        if (!(_current & ((1ULL << _level_shift(XTIMER_WHEEL_LEVELS)) - 1))) {
+            xtimer_t *list = _far;
+            _far = NULL;
+            while (list) {
+                xtimer_t *timer = list;
+                list = list->next;
+                _insert(timer);
+            }
+        }
+
+        /* cascade from the top, so timers end up in the slots handled below */
+        for (unsigned level = XTIMER_WHEEL_LEVELS; level-- > 0;) {
+            unsigned shift = _level_shift(level);
+
+            if (_current & ((1ULL << shift) - 1)) {
+                continue;
+            }
+
+            unsigned idx = (_current >> shift) & (XTIMER_WHEEL_SLOTS - 1);
+            xtimer_t *list = _wheel[level][idx];
+            _wheel[level][idx] = NULL;
+            _used[level] &= ~(1UL << idx);
+            while (list) {
+                xtimer_t *timer = list;
+                list = list->next;
+                _insert(timer);
+            }
+        }
+    }
+}
+
+/**
+ * @brief   get the time the low-level timer has to fire next
+ */
+static uint64_t _get_next_event(uint64_t period_end)
+{
+    uint64_t next = UINT64_MAX;
+    uint64_t slot = _next_slot();
+
+    if (_near) {
+        next = _target(_near);
+        /* timers of the next period are handled after the overflow tick */
+        if (next < period_end) {
+            next -= XTIMER_OVERHEAD;
+        }
+    }
+    if ((slot != UINT64_MAX) && ((slot << XTIMER_WHEEL_SHIFT) < next)) {
+        next = slot << XTIMER_WHEEL_SHIFT;
+    }
+
+    return next;
+}
+
+/**
+ * @brief   update the low-level timer after a timer was added
+ *
+ * Must be called with interrupts disabled.
+ */
+static void _update_lltimer(uint64_t now)
+{
+    if (_in_handler) {
+        /* the handler sets the low-level timer when it is done */
+        return;
+    }
+
+    uint64_t end = _period_start() + XTIMER_PERIOD;
+    uint64_t next = _get_next_event(end);
+
+    /* an event in the past means the handler is already pending */
+    if ((next < _next_event) && (next > now) && (next < end)) {
+        DEBUG("_update_lltimer(): setting %" PRIu32 "\n", (uint32_t)next);
+        _next_event = next;
+        _next_is_period_end = 0;
+        timer_set_absolute(XTIMER_DEV, XTIMER_CHAN, _xtimer_lltimer_mask((uint32_t)next));
+    }
+}
+
+/**
+ * @brief   add a timer with its target already set
+ *
+ * Must be called with interrupts disabled.
+ */
+static void _add(xtimer_t *timer)
+{
+#if XTIMER_WHEEL_SLACK
+    uint64_t target = _target(timer);
+    target = (target + XTIMER_WHEEL_SLACK - 1) & ~((uint64_t)XTIMER_WHEEL_SLACK - 1);
+    timer->target = (uint32_t)target;
+    timer->long_target = (uint32_t)(target >> 32);
+#endif
+
+    uint64_t now = _xtimer_now64();
+
+    /* the wheel is only moved on timer interrupts, so catch up first */
+    _advance(now);
+    _insert(timer);
+    _update_lltimer(now);
+}
+
+static void _set_target(xtimer_t *timer, uint64_t target)
+{
+    timer->target = (uint32_t)target;
+    timer->long_target = (uint32_t)(target >> 32);
+}
+
+void _xtimer_set64(xtimer_t *timer, uint32_t offset, uint32_t long_offset)
+{
+    DEBUG(" _xtimer_set64() offset=%" PRIu32 " long_offset=%" PRIu32 "\n", offset, long_offset);
+    if (!long_offset) {
+        /* timer fits into the short timer */
+        _xtimer_set(timer, (uint32_t) offset);
+    }
+    else {
+        int state = irq_disable();
+        if (_is_set(timer)) {
+            _remove(timer);
+        }
+
+        _set_target(timer, _xtimer_now64() + (((uint64_t)long_offset << 32) | offset));
+        _add(timer);
+        irq_restore(state);
+        DEBUG("xtimer_set64(): added longterm timer (long_target=%" PRIu32 " target=%" PRIu32 ")\n",
+                timer->long_target, timer->target);
+    }
+}
+
+void _xtimer_set(xtimer_t *timer, uint32_t offset)
+{
+    DEBUG("timer_set(): offset=%" PRIu32 " now=%" PRIu32 " (%" PRIu32 ")\n",
+          offset, xtimer_now().ticks32, _xtimer_lltimer_now());
+    if (!timer->callback) {
+        DEBUG("timer_set(): timer has no callback.\n");
+        return;
+    }
+
+    xtimer_remove(timer);
+
+    if (offset < XTIMER_BACKOFF) {
+        _xtimer_spin(offset);
+        _shoot(timer);
+    }
+    else {
+        unsigned state = irq_disable();
+        _set_target(timer, _xtimer_now64() + offset);
+        _add(timer);
+        irq_restore(state);
+    }
+}
+
+static void _periph_timer_callback(void *arg, int chan)
+{
+    (void)arg;
+    (void)chan;
+    _timer_callback();
+}
+
+int _xtimer_set_absolute(xtimer_t *timer, uint32_t target)
+{
+    uint32_t now = _xtimer_now();
+
+    DEBUG("timer_set_absolute(): now=%" PRIu32 " target=%" PRIu32 "\n", now, target);
+
+    timer->next = NULL;
+    if ((target >= now) && ((target - XTIMER_BACKOFF) < now)) {
+        /* backoff */
+        xtimer_spin_until(target + XTIMER_BACKOFF);
+        _shoot(timer);
+        return 0;
+    }
+
+    unsigned state = irq_disable();
+    if (_is_set(timer)) {
+        _remove(timer);
+    }
+
+    uint32_t long_target = _long_cnt;
+    if (target < now) {
+        long_target++;
+    }
+    timer->target = target;
+    timer->long_target = long_target;
+
+    _add(timer);
+    irq_restore(state);
+
+    return 0;
+}
+
+void xtimer_remove(xtimer_t *timer)
+{
+    int state = irq_disable();
+    if (_is_set(timer)) {
+        _remove(timer);
+    }
+    irq_restore(state);
+}
+
+/**
+ * @brief handle low-level timer overflow, advance to next short timer period
+ */
+static void _next_period(void)
+{
+#if XTIMER_MASK
+    /* advance <32bit mask register */
+    _xtimer_high_cnt += ~XTIMER_MASK + 1;
+    if (_xtimer_high_cnt == 0) {
+        /* high_cnt overflowed, so advance >32bit counter */
+        _long_cnt++;
+    }
+#else
+    /* advance >32bit counter */
+    _long_cnt++;
+#endif
+}
+
+/**
+ * @brief main xtimer callback function
+ */
+static void _timer_callback(void)
+{
+    uint32_t reference;
+    uint64_t next;
+#ifdef MODULE_XTIMER_STATS
+    unsigned shots = 0;
+#endif
+
+    _in_handler = 1;
+
+    DEBUG("_timer_callback() now=%" PRIu32 " (%" PRIu32 ")pleft=%" PRIu32 "\n",
+          xtimer_now().ticks32, _xtimer_lltimer_mask(xtimer_now().ticks32),
+          _xtimer_lltimer_mask(0xffffffff - xtimer_now().ticks32));
+
+    if (_next_is_period_end) {
+        DEBUG("_timer_callback(): tick\n");
+        /* make sure the timer counter also arrived
+         * in the next timer period */
+        while (_xtimer_lltimer_now() == _xtimer_lltimer_mask(0xFFFFFFFF));
+        _next_period();
+        reference = 0;
+    }
+    else {
+        /* set our period reference to the current time. */
+        reference = _xtimer_lltimer_now();
+    }
+
+    while (1) {
+        uint32_t now = _xtimer_lltimer_now();
+
+        /* possibly executing all callbacks took enough
+         * time to overflow.  In that case we advance to
+         * next timer period and check again for expired
+         * timers.*/
+        if (now < reference) {
+            DEBUG("_timer_callback: overflowed while executing callbacks.\n");
+            _next_period();
+            reference = 0;
+            continue;
+        }
+
+        uint64_t start = _period_start();
+        uint64_t end = start + XTIMER_PERIOD;
+        uint64_t now64 = start + now;
+
+        _advance(now64 + XTIMER_ISR_BACKOFF);
+
+        /* check if next timers are close to expiring */
+        if (_near && (_target(_near) < end)
+            && (_target(_near) < now64 + XTIMER_ISR_BACKOFF)) {
+            xtimer_t *timer = _near;
+            uint64_t target = _target(timer);
+
+            /* make sure we don't fire too early */
+            while ((start + _xtimer_lltimer_now()) < target);
+
+            _near = timer->next;
+
+            /* make sure timer is recognized as being already fired */
+            timer->target = 0;
+            timer->long_target = 0;
+
+            /* fire timer */
+#ifdef MODULE_XTIMER_STATS
+            _xtimer_stats.fired++;
+            if (shots++) {
+                _xtimer_stats.saved++;
+            }
+#endif
+            _shoot(timer);
+            continue;
+        }
+
+        next = _get_next_event(end);
+        if (next < end) {
+            /* make sure we're not setting a time in the past */
+            if (next < now64 + XTIMER_ISR_BACKOFF) {
+                continue;
+            }
+            _next_is_period_end = 0;
+        }
+        else {
+            /* there's no timer planned for this timer period */
+            /* check if the end of this period is very soon */
+            if ((end - now64) <= XTIMER_ISR_BACKOFF) {
+                /* spin until next period, then advance */
+                while (_xtimer_lltimer_now() >= now);
+                _next_period();
+                reference = 0;
+                continue;
+            }
+            /* schedule callback on next overflow */
+            next = end - 1;
+            _next_is_period_end = 1;
+        }
+        break;
+    }
+
+    _next_event = next;
+    _in_handler = 0;
+
+    /* set low level timer */
+    timer_set_absolute(XTIMER_DEV, XTIMER_CHAN, _xtimer_lltimer_mask((uint32_t)next));
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   event queue test application
+ *
+ * @author  agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event.h"
+#include "event/timeout.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define TIMEOUT     (100U * US_PER_MS)
+
+static char stack[THREAD_STACKSIZE_MAIN];
+static event_queue_t queue = EVENT_QUEUE_INIT_DETACHED;
+
+static unsigned order;
+static unsigned failed;
+
+static void _check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("FAILED: %s\n", what);
+        failed++;
+    }
+}
+
+static void _first_handler(event_t *event)
+{
+    (void)event;
+    printf("first handler, order %u\n", order);
+    _check(order++ == 0, "first event handled first");
+}
+
+static void _second_handler(event_t *event)
+{
+    (void)event;
+    printf("second handler, order %u\n", order);
+    _check(order++ == 1, "second event handled second");
+}
+
+static void _canceled_handler(event_t *event)
+{
+    (void)event;
+    _check(0, "canceled event was not handled");
+}
+
+static void _callback(void *arg)
+{
+    printf("callback event, arg %s\n", (char *)arg);
+    _check(order++ == 2, "callback event handled third");
+}
+
+static uint32_t before_timeout;
+
+static void _timeout_handler(event_t *event)
+{
+    (void)event;
+    uint32_t diff = xtimer_now_usec() - before_timeout;
+    printf("timeout event after %" PRIu32 "us\n", diff);
+    _check(diff >= TIMEOUT, "timeout event not early");
+    _check(order++ == 3, "timeout event handled last");
+}
+
+static event_t first = { .handler = _first_handler };
+static event_t second = { .handler = _second_handler };
+static event_t canceled = { .handler = _canceled_handler };
+static event_callback_t callback;
+static event_t timeout_event = { .handler = _timeout_handler };
+static event_timeout_t timeout;
+
+static void *_handler_thread(void *arg)
+{
+    (void)arg;
+
+    /* events posted before claiming the queue must not get lost */
+    event_queue_claim(&queue);
+    while (order < 4) {
+        event_t *event = event_wait(&queue);
+        event->handler(event);
+    }
+    _check(event_get(&queue) == NULL, "queue is empty");
+
+    printf("%s\n", failed ? "TEST FAILED" : "SUCCESS");
+    return NULL;
+}
+
+int main(void)
+{
+    puts("event test application.");
+
+    event_callback_init(&callback, _callback, "test");
+
+    /* posting an event twice queues it once */
+    event_post(&queue, &first);
+    event_post(&queue, &canceled);
+    event_post(&queue, &second);
+    event_post(&queue, &first);
+    event_cancel(&queue, &canceled);
+    event_post(&queue, &callback.super);
+
+    event_timeout_init(&timeout, &queue, &timeout_event);
+    before_timeout = xtimer_now_usec();
+    event_timeout_set(&timeout, TIMEOUT);
+
+    thread_create(stack, sizeof(stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _handler_thread, NULL, "handler");
+
+    return 0;
+}
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+
+def testfunc(child):
+    child.expect(u"first handler, order 0")
+    child.expect(u"second handler, order 1")
+    child.expect(u"callback event, arg test")
+    child.expect(r"timeout event after \d+us")
+    child.expect(u"SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc))
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the lookup speed of the FIB
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/fib.h"
+#include "xtimer.h"
+
+#define ADDR_SIZE       (16U)
+#define PREFIX_LEN      (48U)
+#define MAX_ROUTES      (1024U)
+#define NEXT_HOPS       (8U)
+#define LOOKUPS         (10000U)
+#define LIFETIME_MS     (600U * MS_PER_SEC)
+
+static const unsigned _routes[] = { 16, 128, MAX_ROUTES };
+
+static fib_entry_t _entries[MAX_ROUTES];
+#ifdef MODULE_FIB_TRIE
+static fib_trie_node_t _trie_pool[FIB_TRIE_POOL_SIZE(MAX_ROUTES)];
+#endif
+static fib_table_t _table = { .data.entries = _entries,
+                              .table_type = FIB_TABLE_TYPE_SH,
+                              .size = MAX_ROUTES,
+                              .mtx_access = MUTEX_INIT,
+#ifdef MODULE_FIB_TRIE
+                              .trie_pool = _trie_pool,
+                              .trie_pool_size = FIB_TRIE_POOL_SIZE(MAX_ROUTES),
+#endif
+                              .notify_rp_pos = 0 };
+
+/* 2001:db8:<idx>::/48 */
+static void _prefix(uint8_t *addr, unsigned idx)
+{
+    memset(addr, 0, ADDR_SIZE);
+    addr[0] = 0x20;
+    addr[1] = 0x01;
+    addr[2] = 0x0d;
+    addr[3] = 0xb8;
+    addr[4] = (uint8_t)(idx >> 8);
+    addr[5] = (uint8_t)idx;
+}
+
+static unsigned _fill(unsigned numof)
+{
+    uint8_t dst[ADDR_SIZE], next_hop[ADDR_SIZE];
+    unsigned added = 0;
+
+    _table.size = numof;
+    fib_init(&_table);
+    for (unsigned i = 0; i < numof; i++) {
+        _prefix(dst, i);
+        /* fe80::<n> */
+        memset(next_hop, 0, sizeof(next_hop));
+        next_hop[0] = 0xfe;
+        next_hop[1] = 0x80;
+        next_hop[15] = (uint8_t)(i % NEXT_HOPS) + 1;
+        if (fib_add_entry(&_table, KERNEL_PID_FIRST, dst, ADDR_SIZE,
+                          PREFIX_LEN << FIB_FLAG_NET_PREFIX_SHIFT,
+                          next_hop, ADDR_SIZE, 0, LIFETIME_MS) == 0) {
+            added++;
+        }
+    }
+    return added;
+}
+
+static unsigned _lookup(unsigned numof)
+{
+    uint8_t dst[ADDR_SIZE], next_hop[ADDR_SIZE];
+    unsigned failed = 0;
+
+    for (unsigned i = 0; i < LOOKUPS; i++) {
+        kernel_pid_t iface;
+        size_t next_hop_size = sizeof(next_hop);
+        uint32_t next_hop_flags;
+
+        /* spread the destinations over all routes */
+        _prefix(dst, (i * 7919U) % numof);
+        dst[15] = (uint8_t)i;
+        if (fib_get_next_hop(&_table, &iface, next_hop, &next_hop_size,
+                             &next_hop_flags, dst, ADDR_SIZE, 0) != 0) {
+            failed++;
+        }
+    }
+    return failed;
+}
+
+int main(void)
+{
+#ifdef MODULE_FIB_TRIE
+    puts("FIB lookup timings (trie)");
+#else
+    puts("FIB lookup timings (linear)");
+#endif
+
+    for (unsigned i = 0; i < (sizeof(_routes) / sizeof(_routes[0])); i++) {
+        unsigned added = _fill(_routes[i]);
+        uint32_t start = xtimer_now_usec();
+        unsigned failed = _lookup(_routes[i]);
+        uint32_t diff = xtimer_now_usec() - start;
+
+        printf("+ %4u routes: %u lookups in %" PRIu32 " us (%" PRIu32 " ns/lookup)",
+               added, LOOKUPS, diff,
+               (uint32_t)(((uint64_t)diff * 1000) / LOOKUPS));
+        if (failed) {
+            printf(", %u failed", failed);
+        }
+        puts("");
+        fib_deinit(&_table);
+    }
+    puts("done");
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the IPv6 send path
+ *
+ * Sends UDP-sized packets to an off-link destination over a dummy interface
+ * and measures the time per packet, once with the next hop and the source
+ * address cached and once with the destination cache invalidated before
+ * every packet.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "net/fib.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/ipv6/nc.h"
+#include "net/gnrc/ipv6/netif.h"
+
+#define PACKETS         (10000U)
+#define PAYLOAD_SIZE    (32U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _main_pid;
+static unsigned _expected;
+static unsigned _count;
+
+static const uint8_t _router_l2addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+
+/* stands in for a network interface, drops all packets */
+static void *_netif(void *arg)
+{
+    msg_t msg, reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
+    msg_t msg_queue[8];
+
+    (void)arg;
+    msg_init_queue(msg_queue, 8);
+    while (1) {
+        msg_receive(&msg);
+        switch (msg.type) {
+            case GNRC_NETAPI_MSG_TYPE_SND:
+                gnrc_pktbuf_release(msg.content.ptr);
+                if (++_count == _expected) {
+                    msg_send(&msg, _main_pid);
+                }
+                break;
+            case GNRC_NETAPI_MSG_TYPE_GET:
+            case GNRC_NETAPI_MSG_TYPE_SET:
+                reply.content.value = (uint32_t)(-ENOTSUP);
+                msg_reply(&msg, &reply);
+                break;
+            default:
+                break;
+        }
+    }
+    return NULL;
+}
+
+static int _send(const ipv6_addr_t *dst)
+{
+    gnrc_pktsnip_t *payload = gnrc_pktbuf_add(NULL, NULL, PAYLOAD_SIZE,
+                                              GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return -ENOMEM;
+    }
+    gnrc_pktsnip_t *ipv6 = gnrc_ipv6_hdr_build(payload, NULL, dst);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(payload);
+        return -ENOMEM;
+    }
+    if (gnrc_netapi_send(gnrc_ipv6_pid, ipv6) < 1) {
+        gnrc_pktbuf_release(ipv6);
+        return -EHOSTUNREACH;
+    }
+    return 0;
+}
+
+static int _bench(const char *name, const ipv6_addr_t *dst, bool invalidate)
+{
+    msg_t msg;
+
+    _count = 0;
+    _expected = PACKETS;
+
+    uint32_t start = xtimer_now_usec();
+    for (unsigned i = 0; i < PACKETS; i++) {
+        if (invalidate) {
+            gnrc_ipv6_nc_changed();
+        }
+        if (_send(dst) < 0) {
+            return -1;
+        }
+    }
+    msg_receive(&msg);
+    uint32_t time = xtimer_now_usec() - start;
+
+    printf("%s: %" PRIu32 " ns per packet\n", name,
+           (uint32_t)(((uint64_t)time * 1000) / PACKETS));
+    return 0;
+}
+
+int main(void)
+{
+    ipv6_addr_t addr, router, dst, any = IPV6_ADDR_UNSPECIFIED;
+
+    puts("IPv6 send path benchmark");
+
+    _main_pid = thread_getpid();
+    kernel_pid_t iface = thread_create(_stack, sizeof(_stack),
+                                       THREAD_PRIORITY_MAIN - 4,
+                                       THREAD_CREATE_STACKTEST, _netif, NULL,
+                                       "netif");
+
+    /* global address, the source of the packets */
+    ipv6_addr_from_str(&addr, "2001:db8::1");
+    /* default route over a reachable link-local router */
+    ipv6_addr_from_str(&router, "fe80::2");
+    /* an off-link destination */
+    ipv6_addr_from_str(&dst, "2001:db8:1::42");
+
+    gnrc_ipv6_netif_add(iface);
+    if ((gnrc_ipv6_netif_add_addr(iface, &addr, 64,
+                                  GNRC_IPV6_NETIF_ADDR_FLAGS_UNICAST) == NULL) ||
+        (gnrc_ipv6_nc_add(iface, &router, _router_l2addr, sizeof(_router_l2addr),
+                          GNRC_IPV6_NC_STATE_REACHABLE) == NULL) ||
+        (fib_add_entry(&gnrc_ipv6_fib_table, iface, any.u8, sizeof(any), 0,
+                       router.u8, sizeof(router), 0,
+                       (uint32_t)FIB_LIFETIME_NO_EXPIRE) < 0)) {
+        puts("FAILURE: could not set up the interface");
+        return 1;
+    }
+
+    if ((_bench("cached", &dst, false) < 0) ||
+        (_bench("invalidated", &dst, true) < 0)) {
+        puts("FAILURE: could not send packet");
+        return 1;
+    }
+    printf("(%u packets with %u byte payload each)\n", PACKETS, PAYLOAD_SIZE);
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the IPv6 forwarding path
+ *
+ * Hands packets to IPv6 as if they were received on the first interface and
+ * measures the time per packet until they are forwarded over the second
+ * one. This is not an interface-to-interface throughput: packets never pass
+ * through tap0 or its netdev driver, only the egress side sends them out of
+ * tap1.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "utlist.h"
+#include "xtimer.h"
+#include "net/fib.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/nc.h"
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/protnum.h"
+
+#define PACKETS         (10000U)
+#define PAYLOAD_SIZE    (32U)
+#define HOP_LIMIT       (64U)
+
+/* the packet buffer may run full while the tap interface is busy */
+#define RETRIES         (100U)
+#define RETRY_DELAY     (1000U)
+
+static kernel_pid_t _in, _out;
+static ipv6_addr_t _src, _dst;
+
+static uint8_t _host_l2addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static uint8_t _router_l2addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+
+/* builds a packet the way an ethernet interface hands it to IPv6: the IPv6
+ * packet in one snip, followed by the netif header */
+static gnrc_pktsnip_t *_build(uint8_t hl)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+    ipv6_hdr_t *hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, sizeof(ipv6_hdr_t) + PAYLOAD_SIZE,
+                          GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    memset(pkt->data, 0, pkt->size);
+    hdr = pkt->data;
+    ipv6_hdr_set_version(hdr);
+    hdr->len = byteorder_htons(PAYLOAD_SIZE);
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    hdr->hl = hl;
+    memcpy(&hdr->src, &_src, sizeof(ipv6_addr_t));
+    memcpy(&hdr->dst, &_dst, sizeof(ipv6_addr_t));
+
+    netif = gnrc_netif_hdr_build(_host_l2addr, sizeof(_host_l2addr),
+                                 _router_l2addr, sizeof(_router_l2addr));
+    if (netif == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = _in;
+    LL_APPEND(pkt, netif);
+    return pkt;
+}
+
+/* simulates the reception on the first interface by handing pkt, which
+ * carries that interface in its netif header, directly to IPv6 */
+static int _receive(gnrc_pktsnip_t *pkt)
+{
+    if (gnrc_netapi_receive(gnrc_ipv6_pid, pkt) < 1) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    return 0;
+}
+
+/* IPv6 and the interfaces have a higher priority than main, so when this
+ * returns, IPv6 is done with the packets given to it */
+static uint32_t _forwarded(void)
+{
+    return gnrc_ipv6_netif_get_stats(_out)->tx_unicast_count;
+}
+
+static int _test_hop_limit(void)
+{
+    uint32_t count = _forwarded();
+    gnrc_pktsnip_t *pkt = _build(1);
+
+    if ((pkt == NULL) || (_receive(pkt) < 0) || (_forwarded() != count)) {
+        return -1;
+    }
+    puts("hop limit 1: dropped");
+    return 0;
+}
+
+static int _test_shared(void)
+{
+    uint32_t count = _forwarded();
+    gnrc_pktsnip_t *pkt = _build(HOP_LIMIT);
+    int res = 0;
+
+    if (pkt == NULL) {
+        return -1;
+    }
+    gnrc_pktbuf_hold(pkt, 1);
+    if ((_receive(pkt) < 0) || (_forwarded() != (count + 1)) ||
+        (((ipv6_hdr_t *)pkt->data)->hl != HOP_LIMIT)) {
+        res = -1;
+    }
+    gnrc_pktbuf_release(pkt);
+    if (res == 0) {
+        puts("shared: forwarded a copy");
+    }
+    return res;
+}
+
+static int _bench(void)
+{
+    uint32_t count = _forwarded();
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < PACKETS; i++) {
+        gnrc_pktsnip_t *pkt;
+        unsigned retries = 0;
+
+        while ((pkt = _build(HOP_LIMIT)) == NULL) {
+            if (++retries == RETRIES) {
+                return -1;
+            }
+            xtimer_usleep(RETRY_DELAY);
+        }
+        if (_receive(pkt) < 0) {
+            return -1;
+        }
+    }
+    uint32_t time = xtimer_now_usec() - start;
+
+    if ((_forwarded() - count) != PACKETS) {
+        printf("forwarded %" PRIu32 " of %u packets\n", _forwarded() - count,
+               PACKETS);
+        return -1;
+    }
+    printf("forwarded: %" PRIu32 " ns per packet\n",
+           (uint32_t)(((uint64_t)time * 1000) / PACKETS));
+    return 0;
+}
+
+int main(void)
+{
+    kernel_pid_t ifs[GNRC_NETIF_NUMOF];
+    ipv6_addr_t in_addr, out_addr, router, any = IPV6_ADDR_UNSPECIFIED;
+
+    puts("IPv6 forwarding path benchmark");
+
+    if (gnrc_netif_get(ifs) < 2) {
+        puts("FAILURE: two interfaces required");
+        return 1;
+    }
+    _in = ifs[0];
+    _out = ifs[1];
+
+    ipv6_addr_from_str(&in_addr, "2001:db8:a::1");
+    ipv6_addr_from_str(&out_addr, "2001:db8:b::1");
+    /* default route over a reachable link-local router on the second
+     * interface */
+    ipv6_addr_from_str(&router, "fe80::2");
+    /* a host on the link of the first interface sends to an off-link
+     * destination */
+    ipv6_addr_from_str(&_src, "2001:db8:a::2");
+    ipv6_addr_from_str(&_dst, "2001:db8:1::42");
+
+    if ((gnrc_ipv6_netif_add_addr(_in, &in_addr, 64,
+                                  GNRC_IPV6_NETIF_ADDR_FLAGS_UNICAST) == NULL) ||
+        (gnrc_ipv6_netif_add_addr(_out, &out_addr, 64,
+                                  GNRC_IPV6_NETIF_ADDR_FLAGS_UNICAST) == NULL) ||
+        (gnrc_ipv6_nc_add(_out, &router, _router_l2addr, sizeof(_router_l2addr),
+                          GNRC_IPV6_NC_STATE_REACHABLE) == NULL) ||
+        (fib_add_entry(&gnrc_ipv6_fib_table, _out, any.u8, sizeof(any), 0,
+                       router.u8, sizeof(router), 0,
+                       (uint32_t)FIB_LIFETIME_NO_EXPIRE) < 0)) {
+        puts("FAILURE: could not set up the interfaces");
+        return 1;
+    }
+
+    if (_test_hop_limit() < 0) {
+        puts("FAILURE: packet with hop limit 1 was forwarded");
+        return 1;
+    }
+    if (_test_shared() < 0) {
+        puts("FAILURE: shared packet was not forwarded or was changed");
+        return 1;
+    }
+    if (_bench() < 0) {
+        puts("FAILURE: could not forward packets");
+        return 1;
+    }
+    printf("(%u packets with %u byte payload each)\n", PACKETS, PAYLOAD_SIZE);
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+
+def testfunc(child):
+    child.expect_exact(u"hop limit 1: dropped")
+    child.expect_exact(u"shared: forwarded a copy")
+    child.expect(r"forwarded: \d+ ns per packet")
+    child.expect_exact(u"SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc))
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the IPv6 neighbor cache
+ *
+ * Compares lookups in the hashed neighbor cache to a linear search in an
+ * array, as the neighbor cache did before.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/ipv6/nc.h"
+#include "xtimer.h"
+
+#define IFACE           (6)
+#define LOOKUPS         (100000U)
+
+static const unsigned _sizes[] = { 8, 64, 512 };
+
+static gnrc_ipv6_nc_t _array[GNRC_IPV6_NC_SIZE];
+static ipv6_addr_t _addrs[GNRC_IPV6_NC_SIZE];
+
+/* the linear search gnrc_ipv6_nc_get() did before */
+static gnrc_ipv6_nc_t *_array_get(kernel_pid_t iface, const ipv6_addr_t *ipv6_addr)
+{
+    for (int i = 0; i < GNRC_IPV6_NC_SIZE; i++) {
+        if (((_array[i].iface == KERNEL_PID_UNDEF) || (iface == KERNEL_PID_UNDEF) ||
+             (iface == _array[i].iface)) &&
+            ipv6_addr_equal(&(_array[i].ipv6_addr), ipv6_addr)) {
+            return _array + i;
+        }
+    }
+    return NULL;
+}
+
+static void _addr(ipv6_addr_t *addr, unsigned i)
+{
+    /* link-local addresses derived from short addresses, as in 6LoWPAN */
+    ipv6_addr_set_link_local_prefix(addr);
+    addr->u16[5] = byteorder_htons(0x00ff);
+    addr->u16[6] = byteorder_htons(0xfe00);
+    addr->u16[7] = byteorder_htons(i + 1);
+}
+
+static uint32_t _bench(gnrc_ipv6_nc_t *(*get)(kernel_pid_t, const ipv6_addr_t *),
+                       unsigned numof, bool same)
+{
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < LOOKUPS; i++) {
+        /* the last neighbor is the worst case for the array */
+        unsigned n = same ? (numof - 1) : (i % numof);
+        if (get(IFACE, &_addrs[n]) == NULL) {
+            return 0;
+        }
+    }
+
+    return xtimer_now_usec() - start;
+}
+
+int main(void)
+{
+    puts("IPv6 neighbor cache benchmark");
+
+    gnrc_ipv6_nc_init();
+    for (unsigned i = 0; i < GNRC_IPV6_NC_SIZE; i++) {
+        _addr(&_addrs[i], i);
+    }
+
+    unsigned numof = 0;
+    for (unsigned s = 0; s < sizeof(_sizes) / sizeof(_sizes[0]); s++) {
+        for (; numof < _sizes[s]; numof++) {
+            gnrc_ipv6_nc_t *entry = gnrc_ipv6_nc_add(IFACE, &_addrs[numof],
+                                                     NULL, 0, 0);
+            if (entry == NULL) {
+                puts("FAILURE: could not add neighbor");
+                return 1;
+            }
+            memcpy(&_array[numof], entry, sizeof(*entry));
+        }
+
+        uint32_t array_all = _bench(_array_get, numof, false);
+        uint32_t nc_all = _bench(gnrc_ipv6_nc_get, numof, false);
+        uint32_t array_same = _bench(_array_get, numof, true);
+        uint32_t nc_same = _bench(gnrc_ipv6_nc_get, numof, true);
+
+        if (!array_all || !nc_all || !array_same || !nc_same) {
+            puts("FAILURE: lookup failed");
+            return 1;
+        }
+        printf("%3u neighbors: all: array %7" PRIu32 "us, nc %7" PRIu32 "us; "
+               "same: array %7" PRIu32 "us, nc %7" PRIu32 "us\n",
+               numof, array_all, nc_all, array_same, nc_same);
+    }
+    printf("(%u lookups each)\n", LOOKUPS);
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures packet throughput of batched vs. unbatched netapi
+ *              dispatch
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "xtimer.h"
+
+#define PACKETS         (20000U)
+#define PAYLOAD_SIZE    (64U)
+#define DEMUX_CTX       (0x1234)
+#define MSG_QUEUE_SIZE  (8U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static char _sniffer_stack[THREAD_STACKSIZE_DEFAULT];
+static unsigned _received, _sniffed;
+static uint32_t _checksum;
+
+static void _handle(gnrc_pktsnip_t *pkt)
+{
+    /* do a little bit of work with the packet like a network layer would */
+    _checksum += ((uint8_t *)pkt->data)[0];
+    _received++;
+    gnrc_pktbuf_release(pkt);
+}
+
+static void *_receiver(void *arg)
+{
+    msg_t msg, msg_queue[MSG_QUEUE_SIZE];
+    gnrc_netreg_entry_t me = GNRC_NETREG_ENTRY_INIT_PID(DEMUX_CTX,
+                                                        sched_active_pid);
+
+    (void)arg;
+    msg_init_queue(msg_queue, MSG_QUEUE_SIZE);
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &me);
+    gnrc_netapi_batch_accept(&me);
+
+    while (1) {
+        msg_receive(&msg);
+        switch (msg.type) {
+            case GNRC_NETAPI_MSG_TYPE_RCV:
+                _handle(msg.content.ptr);
+                break;
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH: {
+                gnrc_pktsnip_t *batch = msg.content.ptr;
+
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(batch); i++) {
+                    _handle(gnrc_netapi_batch_get(batch, i));
+                }
+                gnrc_pktbuf_release(batch);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return NULL;
+}
+
+/* a subscriber that does not handle batches gets every packet on its own */
+static void *_sniffer(void *arg)
+{
+    msg_t msg, msg_queue[MSG_QUEUE_SIZE];
+    gnrc_netreg_entry_t me = GNRC_NETREG_ENTRY_INIT_PID(DEMUX_CTX,
+                                                        sched_active_pid);
+
+    (void)arg;
+    msg_init_queue(msg_queue, MSG_QUEUE_SIZE);
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &me);
+
+    while (1) {
+        msg_receive(&msg);
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            _sniffed++;
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+    return NULL;
+}
+
+static gnrc_pktsnip_t *_alloc(unsigned i)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, PAYLOAD_SIZE,
+                                          GNRC_NETTYPE_UNDEF);
+
+    if (pkt != NULL) {
+        ((uint8_t *)pkt->data)[0] = (uint8_t)i;
+    }
+    return pkt;
+}
+
+static void _print_result(const char *name, uint32_t start)
+{
+    uint32_t diff = xtimer_now_usec() - start;
+
+    printf("+ %s: %u packets in %" PRIu32 " us (%" PRIu32 " packets/s)\n",
+           name, _received, diff,
+           (uint32_t)(((uint64_t)_received * US_PER_SEC) / diff));
+}
+
+static bool _unbatched(void)
+{
+    uint32_t start;
+
+    _received = 0;
+    _sniffed = 0;
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < PACKETS; i++) {
+        gnrc_pktsnip_t *pkt = _alloc(i);
+
+        if ((pkt != NULL) &&
+            !gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UNDEF, DEMUX_CTX, pkt)) {
+            gnrc_pktbuf_release(pkt);
+        }
+    }
+    _print_result("unbatched", start);
+    return (_received == PACKETS) && (_sniffed == PACKETS);
+}
+
+static bool _batched(void)
+{
+    gnrc_pktsnip_t *pkts[GNRC_NETAPI_BATCH_SIZE];
+    unsigned numof = 0;
+    uint32_t start;
+
+    _received = 0;
+    _sniffed = 0;
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < PACKETS; i++) {
+        gnrc_pktsnip_t *pkt = _alloc(i);
+
+        if (pkt != NULL) {
+            pkts[numof++] = pkt;
+        }
+        if ((numof == GNRC_NETAPI_BATCH_SIZE) ||
+            ((i == (PACKETS - 1)) && (numof > 0))) {
+            gnrc_netapi_dispatch_receive_batch(GNRC_NETTYPE_UNDEF, DEMUX_CTX,
+                                               pkts, numof);
+            numof = 0;
+        }
+    }
+    _print_result("batched", start);
+    return (_received == PACKETS) && (_sniffed == PACKETS);
+}
+
+int main(void)
+{
+    puts("netapi batch dispatch benchmark");
+    printf("%u packets of %u byte, batch size %u\n", PACKETS, PAYLOAD_SIZE,
+           GNRC_NETAPI_BATCH_SIZE);
+
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _receiver, NULL, "receiver");
+    thread_create(_sniffer_stack, sizeof(_sniffer_stack),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST, _sniffer,
+                  NULL, "sniffer");
+
+    if (_unbatched() && _batched()) {
+        puts("SUCCESS");
+    }
+    else {
+        puts("FAILED: packets were lost");
+    }
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Stress test for concurrent reference counting of packets
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/gnrc/pktbuf.h"
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define WORKER_NUMOF        (4U)
+#define ITERATIONS          (2000U)
+#define YIELD_INTERVAL      (16U)
+#define PREEMPT_INTERVAL    (250U)
+
+static char _worker_stacks[WORKER_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static char _preempt_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_pktsnip_t *_shared;
+static mutex_t _done[WORKER_NUMOF];
+static volatile unsigned _failed = 0;
+static volatile bool _stop = false;
+
+static void _use_shared(unsigned i)
+{
+    gnrc_pktsnip_t *tmp;
+
+    gnrc_pktbuf_hold(_shared, 1);
+    /* allocate and release a header of our own in between */
+    tmp = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_UNDEF);
+    if (tmp == NULL) {
+        _failed++;
+    }
+    else {
+        gnrc_pktbuf_release(tmp);
+    }
+    if ((i % 4) == 0) {
+        /* writing to the shared packet creates a copy of the first snip that
+         * takes over our reference to the remaining snips */
+        tmp = gnrc_pktbuf_start_write(_shared);
+        if (tmp == NULL) {
+            _failed++;
+            gnrc_pktbuf_release(_shared);
+        }
+        else {
+            gnrc_pktbuf_release(tmp);
+        }
+    }
+    else {
+        gnrc_pktbuf_release(_shared);
+    }
+}
+
+static void *_worker(void *arg)
+{
+    mutex_t *done = arg;
+
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        _use_shared(i);
+        if ((i % YIELD_INTERVAL) == 0) {
+            thread_yield();
+        }
+    }
+    mutex_unlock(done);
+    return NULL;
+}
+
+static void *_preempt(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; !_stop; i++) {
+        xtimer_usleep(PREEMPT_INTERVAL);
+        _use_shared(i);
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    puts("gnrc_pktbuf reference counting stress test");
+
+    _shared = gnrc_pktbuf_add(NULL, "payload", sizeof("payload"),
+                              GNRC_NETTYPE_UNDEF);
+    _shared = gnrc_pktbuf_add(_shared, "header", sizeof("header"),
+                              GNRC_NETTYPE_UNDEF);
+    _shared = gnrc_pktbuf_add(_shared, NULL, 4, GNRC_NETTYPE_NETIF);
+    if (_shared == NULL) {
+        puts("FAILURE: could not allocate shared packet");
+        return 1;
+    }
+    thread_create(_preempt_stack, sizeof(_preempt_stack),
+                  THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_STACKTEST,
+                  _preempt, NULL, "preempt");
+    for (unsigned i = 0; i < WORKER_NUMOF; i++) {
+        mutex_init(&_done[i]);
+        mutex_lock(&_done[i]);
+        thread_create(_worker_stacks[i], sizeof(_worker_stacks[i]),
+                      THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                      _worker, &_done[i], "worker");
+    }
+    for (unsigned i = 0; i < WORKER_NUMOF; i++) {
+        mutex_lock(&_done[i]);
+    }
+    _stop = true;
+    /* let preempt thread finish its last round */
+    xtimer_usleep(2 * PREEMPT_INTERVAL);
+
+    for (gnrc_pktsnip_t *snip = _shared; snip != NULL; snip = snip->next) {
+        if (snip->users != 1) {
+            printf("FAILURE: snip %p has %u users\n", (void *)snip,
+                   (unsigned)snip->users);
+            return 1;
+        }
+    }
+    if (!gnrc_pktbuf_is_sane()) {
+        puts("FAILURE: packet buffer is not sane");
+        return 1;
+    }
+    gnrc_pktbuf_release(_shared);
+    if (!gnrc_pktbuf_is_empty()) {
+        puts("FAILURE: packet buffer is not empty");
+        return 1;
+    }
+    if (_failed > 0) {
+        printf("FAILURE: %u allocations failed\n", _failed);
+        return 1;
+    }
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures allocation and release speed of the packet buffer
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/gnrc/pktbuf.h"
+#include "xtimer.h"
+
+#define ITERATIONS      (10000U)
+#define HELD_NUMOF      (8U)
+
+/* 802.15.4 header, IPv6 header, UDP payload, netif header */
+static const size_t _sizes[] = { 21, 40, 100, 8, 24 };
+
+#define SIZES_NUMOF     (sizeof(_sizes) / sizeof(_sizes[0]))
+
+static gnrc_pktsnip_t *_held[HELD_NUMOF];
+
+static void _print_result(const char *name, uint32_t start, unsigned ops)
+{
+    uint32_t diff = xtimer_now_usec() - start;
+
+    printf("+ %s: %u operations in %" PRIu32 " us (%" PRIu32 " ns/op)\n",
+           name, ops, diff, (uint32_t)(((uint64_t)diff * 1000) / ops));
+}
+
+static unsigned _churn(void)
+{
+    unsigned failed = 0;
+
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                              _sizes[i % SIZES_NUMOF],
+                                              GNRC_NETTYPE_UNDEF);
+        if (pkt == NULL) {
+            failed++;
+            continue;
+        }
+        /* add a header like the upper layers would */
+        pkt = gnrc_pktbuf_add(pkt, NULL, _sizes[(i + 1) % SIZES_NUMOF],
+                              GNRC_NETTYPE_UNDEF);
+        if (pkt == NULL) {
+            failed++;
+            continue;
+        }
+        gnrc_pktbuf_release(pkt);
+    }
+    return failed;
+}
+
+static void _fragment(void)
+{
+    gnrc_pktsnip_t *tmp[HELD_NUMOF];
+
+    for (unsigned i = 0; i < HELD_NUMOF; i++) {
+        _held[i] = gnrc_pktbuf_add(NULL, NULL, _sizes[i % SIZES_NUMOF],
+                                   GNRC_NETTYPE_UNDEF);
+        tmp[i] = gnrc_pktbuf_add(NULL, NULL, _sizes[(i + 2) % SIZES_NUMOF],
+                                 GNRC_NETTYPE_UNDEF);
+    }
+    for (unsigned i = 0; i < HELD_NUMOF; i++) {
+        if (tmp[i] != NULL) {
+            gnrc_pktbuf_release(tmp[i]);
+        }
+    }
+}
+
+static void _unfragment(void)
+{
+    for (unsigned i = 0; i < HELD_NUMOF; i++) {
+        if (_held[i] != NULL) {
+            gnrc_pktbuf_release(_held[i]);
+        }
+    }
+}
+
+int main(void)
+{
+    uint32_t start;
+    unsigned failed;
+
+    puts("Start.");
+    gnrc_pktbuf_init();
+
+    start = xtimer_now_usec();
+    failed = _churn();
+    _print_result("churn", start, 2 * ITERATIONS);
+    printf("  failed allocations: %u\n", failed);
+
+    _fragment();
+    start = xtimer_now_usec();
+    failed = _churn();
+    _print_result("fragmented", start, 2 * ITERATIONS);
+    printf("  failed allocations: %u\n", failed);
+
+    gnrc_pktbuf_stats();
+    _unfragment();
+
+    puts("Done.");
+    return 0;
+}
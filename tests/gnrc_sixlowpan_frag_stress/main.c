@@ -0,0 +1,316 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Stress test for the 6LoWPAN reassembly buffer
+ *
+ * Hands interleaved, reordered and duplicated fragments of many senders to
+ * 6LoWPAN and checks the reassembled datagrams, the eviction of the oldest
+ * datagrams when there are more senders than reassembly buffer entries and
+ * the removal of timed out datagrams.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "utlist.h"
+#include "xtimer.h"
+#include "net/ipv6/hdr.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+
+#define SENDERS         (GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
+/* senders beyond the size of the reassembly buffer */
+#define EXTRA_SENDERS   (4U)
+#define ALL_SENDERS     (SENDERS + EXTRA_SENDERS)
+#define ROUNDS          (8U)
+#define FRAG_SIZE       (48U)   /* multiple of 8 */
+#define FRAGS           (5U)
+#define DATAGRAM_SIZE   (FRAGS * FRAG_SIZE)
+#define L2ADDR_LEN      (8U)
+#define MAIN_QUEUE_SIZE (32U)
+
+/* must be greater than RBUF_TIMEOUT of the reassembly buffer */
+#define TIMEOUT         (4U * US_PER_SEC)
+/* lets the arrival times of the reassembly buffer entries differ */
+#define ARRIVAL_GAP     (100U)
+
+#if ALL_SENDERS > 32
+#error "_drain() tells at most 32 senders apart"
+#endif
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static const uint8_t _dst_l2addr[] = { 0x02, 0x00, 0x00, 0xff,
+                                       0xfe, 0x00, 0x00, 0x01 };
+
+/* fragments out of order, the second one twice */
+static const uint8_t _order[] = { 4, 0, 2, 1, 1, 3 };
+
+static uint8_t _datagram[DATAGRAM_SIZE];
+
+static void _build_datagram(unsigned sender, uint16_t tag)
+{
+    ipv6_hdr_t *hdr = (ipv6_hdr_t *)_datagram;
+
+    memset(hdr, 0, sizeof(ipv6_hdr_t));
+    ipv6_hdr_set_version(hdr);
+    hdr->len = byteorder_htons(DATAGRAM_SIZE - sizeof(ipv6_hdr_t));
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    hdr->hl = 64;
+    for (unsigned i = sizeof(ipv6_hdr_t); i < DATAGRAM_SIZE; i++) {
+        _datagram[i] = (uint8_t)(i + (sender * 7) + tag);
+    }
+}
+
+static void _sender_l2addr(uint8_t *addr, unsigned sender)
+{
+    memcpy(addr, _dst_l2addr, L2ADDR_LEN);
+    addr[L2ADDR_LEN - 1] = (uint8_t)(sender + 2);
+}
+
+/* builds fragment idx of the datagram in _datagram and hands it to
+ * 6LoWPAN */
+static int _send_frag(unsigned sender, uint16_t tag, unsigned idx)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+    uint8_t src[L2ADDR_LEN];
+    size_t hdr_len = (idx == 0) ? sizeof(sixlowpan_frag_t) + 1 :
+                                  sizeof(sixlowpan_frag_n_t);
+    sixlowpan_frag_t *frag;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, hdr_len + FRAG_SIZE,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return -1;
+    }
+    frag = pkt->data;
+    frag->disp_size = byteorder_htons(DATAGRAM_SIZE);
+    frag->tag = byteorder_htons(tag);
+    if (idx == 0) {
+        frag->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        ((uint8_t *)(frag + 1))[0] = SIXLOWPAN_UNCOMP;
+    }
+    else {
+        frag->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        ((sixlowpan_frag_n_t *)frag)->offset = (idx * FRAG_SIZE) / 8;
+    }
+    memcpy(((uint8_t *)pkt->data) + hdr_len, &_datagram[idx * FRAG_SIZE],
+           FRAG_SIZE);
+
+    _sender_l2addr(src, sender);
+    netif = gnrc_netif_hdr_build(src, L2ADDR_LEN, (uint8_t *)_dst_l2addr,
+                                 L2ADDR_LEN);
+    if (netif == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    LL_APPEND(pkt, netif);
+
+    /* 6LoWPAN has a higher priority than main, so the fragment is handled
+     * when this returns */
+    if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_SIXLOWPAN,
+                                      GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+        return -1;
+    }
+    return 0;
+}
+
+/* checks a reassembled datagram, returns the sender or -1 if it is
+ * malformed */
+static int _check(gnrc_pktsnip_t *pkt, uint16_t tag)
+{
+    gnrc_pktsnip_t *netif = gnrc_pktsnip_search_type(pkt,
+                                                     GNRC_NETTYPE_NETIF);
+    gnrc_netif_hdr_t *hdr;
+    uint8_t src[L2ADDR_LEN];
+    unsigned sender;
+
+    if ((pkt->type != GNRC_NETTYPE_IPV6) || (pkt->size != DATAGRAM_SIZE) ||
+        (netif == NULL)) {
+        return -1;
+    }
+    hdr = netif->data;
+    if (hdr->src_l2addr_len != L2ADDR_LEN) {
+        return -1;
+    }
+    sender = gnrc_netif_hdr_get_src_addr(hdr)[L2ADDR_LEN - 1] - 2;
+    _sender_l2addr(src, sender);
+    if ((sender >= ALL_SENDERS) ||
+        (memcmp(gnrc_netif_hdr_get_src_addr(hdr), src, L2ADDR_LEN) != 0)) {
+        return -1;
+    }
+    _build_datagram(sender, tag);
+    if (memcmp(pkt->data, _datagram, DATAGRAM_SIZE) != 0) {
+        return -1;
+    }
+    return (int)sender;
+}
+
+/* takes all reassembled datagrams out of the message queue, returns their
+ * number or -1 if one is malformed or came twice */
+static int _drain(uint16_t tag)
+{
+    uint32_t seen = 0;
+    int res = 0;
+    msg_t msg;
+
+    while (msg_try_receive(&msg) == 1) {
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_RCV) {
+            continue;
+        }
+        int sender = _check(msg.content.ptr, tag);
+
+        if ((sender < 0) || (seen & (1UL << sender))) {
+            res = -1;
+        }
+        else if (res >= 0) {
+            seen |= (1UL << sender);
+            res++;
+        }
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+    return res;
+}
+
+static int _test_interleaved(void)
+{
+    for (uint16_t tag = 1; tag <= ROUNDS; tag++) {
+        /* all senders use the same tag, only their addresses tell the
+         * datagrams apart */
+        for (unsigned i = 0; i < sizeof(_order); i++) {
+            for (unsigned sender = 0; sender < SENDERS; sender++) {
+                _build_datagram(sender, tag);
+                if (_send_frag(sender, tag, _order[i]) < 0) {
+                    return -1;
+                }
+            }
+        }
+        if (_drain(tag) != SENDERS) {
+            printf("round %u: not all datagrams were reassembled\n", tag);
+            return -1;
+        }
+    }
+    printf("interleaved: reassembled %u datagrams from %u senders\n",
+           SENDERS * ROUNDS, SENDERS);
+    return 0;
+}
+
+static int _test_timeout(void)
+{
+    uint16_t tag = ROUNDS + 1;
+
+    if (!gnrc_pktbuf_is_empty()) {
+        puts("timeout: packet buffer not empty before the test");
+        return -1;
+    }
+    _build_datagram(0, tag);
+    if (_send_frag(0, tag, 0) < 0) {
+        return -1;
+    }
+    if (gnrc_pktbuf_is_empty()) {
+        puts("timeout: first fragment was not kept");
+        return -1;
+    }
+    /* only the garbage collection timer can remove the first fragment, no
+     * more fragments are sent that would find it expired */
+    xtimer_usleep(TIMEOUT);
+    if (!gnrc_pktbuf_is_empty()) {
+        puts("timeout: incomplete datagram was not removed");
+        return -1;
+    }
+    puts("timeout: incomplete datagram discarded");
+    return 0;
+}
+
+static int _send_rest(unsigned sender, uint16_t tag)
+{
+    _build_datagram(sender, tag);
+    for (unsigned idx = 1; idx < FRAGS; idx++) {
+        if (_send_frag(sender, tag, idx) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int _test_eviction(void)
+{
+    uint16_t tag = ROUNDS + 2;
+
+    /* the first fragments of the first EXTRA_SENDERS senders are evicted by
+     * those of the last EXTRA_SENDERS */
+    for (unsigned sender = 0; sender < ALL_SENDERS; sender++) {
+        _build_datagram(sender, tag);
+        if (_send_frag(sender, tag, 0) < 0) {
+            return -1;
+        }
+        xtimer_usleep(ARRIVAL_GAP);
+    }
+    for (unsigned sender = EXTRA_SENDERS; sender < ALL_SENDERS; sender++) {
+        if (_send_rest(sender, tag) < 0) {
+            return -1;
+        }
+    }
+    if (_drain(tag) != SENDERS) {
+        puts("eviction: datagrams of the newest senders were not reassembled");
+        return -1;
+    }
+    for (unsigned sender = 0; sender < EXTRA_SENDERS; sender++) {
+        if (_send_rest(sender, tag) < 0) {
+            return -1;
+        }
+    }
+    if (_drain(tag) != 0) {
+        puts("eviction: datagrams of evicted senders were reassembled");
+        return -1;
+    }
+    printf("eviction: %u of %u senders evicted\n", EXTRA_SENDERS, ALL_SENDERS);
+    return 0;
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t ipv6 = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                          sched_active_pid);
+
+    puts("6LoWPAN reassembly buffer stress test");
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &ipv6);
+
+    if (_test_interleaved() < 0) {
+        puts("FAILURE: interleaved datagrams were not reassembled");
+        return 1;
+    }
+    if (_test_timeout() < 0) {
+        puts("FAILURE: timed out fragment was not discarded");
+        return 1;
+    }
+    if (_test_eviction() < 0) {
+        puts("FAILURE: oldest datagrams were not evicted");
+        return 1;
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
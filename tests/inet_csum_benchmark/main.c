@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the Internet Checksum
+ *
+ * Compares inet_csum() to a byte-wise implementation and a full
+ * recalculation to inet_csum_update16().
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/inet_csum.h"
+#include "xtimer.h"
+
+#define ITERATIONS      (1000U)
+#define BUF_SIZE        (1280U)
+
+static uint8_t _buf[BUF_SIZE];
+static const uint16_t _sizes[] = { 8, 40, 127, 1280 };
+
+static uint16_t _csum_bytewise(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (int i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+int main(void)
+{
+    volatile uint16_t res = 0;
+
+    puts("inet_csum benchmark");
+
+    for (unsigned i = 0; i < BUF_SIZE; i++) {
+        _buf[i] = i;
+    }
+
+    for (unsigned s = 0; s < sizeof(_sizes) / sizeof(_sizes[0]); s++) {
+        uint16_t len = _sizes[s];
+        uint32_t start = xtimer_now_usec();
+
+        for (unsigned i = 0; i < ITERATIONS; i++) {
+            res = _csum_bytewise(0, _buf, len);
+        }
+        uint32_t bytewise = xtimer_now_usec() - start;
+
+        start = xtimer_now_usec();
+        for (unsigned i = 0; i < ITERATIONS; i++) {
+            res = inet_csum(0, _buf, len);
+        }
+        uint32_t words = xtimer_now_usec() - start;
+
+        if (res != _csum_bytewise(0, _buf, len)) {
+            puts("FAILURE: checksum mismatch");
+            return 1;
+        }
+        printf("%4u bytes: bytewise %6" PRIu32 "us, inet_csum %6" PRIu32
+               "us (%u iterations)\n", len, bytewise, words, ITERATIONS);
+    }
+
+    /* rewriting a 16-bit word of a 1280 byte packet */
+    uint16_t csum = ~inet_csum(0, _buf, BUF_SIZE);
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        _buf[0] ^= 0xff;
+        res = ~inet_csum(0, _buf, BUF_SIZE);
+    }
+    uint32_t full = xtimer_now_usec() - start;
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        uint16_t old = (_buf[0] << 8) | _buf[1];
+        _buf[0] ^= 0xff;
+        csum = inet_csum_update16(csum, old, (_buf[0] << 8) | _buf[1]);
+    }
+    uint32_t update = xtimer_now_usec() - start;
+
+    /* compare in one's complement, where 0x0000 and 0xffff are both zero */
+    uint16_t expected = ~inet_csum(0, _buf, BUF_SIZE);
+    if ((csum != expected) && ((uint16_t)(csum ^ expected) != 0xffff)) {
+        puts("FAILURE: incremental update mismatch");
+        return 1;
+    }
+    printf("update: recalculate %6" PRIu32 "us, inet_csum_update16 %6" PRIu32
+           "us (%u iterations)\n", full, update, ITERATIONS);
+
+    puts("SUCCESS");
+
+    return 0;
+}
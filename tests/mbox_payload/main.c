@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares moving 1 KiB blocks through a pipe and through a
+ *              mailbox with payload buffers
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mbox_payload.h"
+#include "pipe.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define BLOCK_SIZE      (1024U)
+#define BLOCK_NUMOF     (4U)
+#define TRANSFERS       (10000U)
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+
+/* pipe: data is copied into and out of the ringbuffer */
+static char _pipe_buf[BLOCK_NUMOF * BLOCK_SIZE];
+static ringbuffer_t _rb;
+static pipe_t _pipe;
+static uint8_t _block_out[BLOCK_SIZE];
+static uint8_t _block_in[BLOCK_SIZE];
+
+/* mailbox: only references to the pool's buffers are passed */
+static uint8_t _pool_bufs[BLOCK_NUMOF][BLOCK_SIZE];
+static msg_t _pool_queue[BLOCK_NUMOF];
+static mbox_payload_pool_t _pool;
+static msg_t _mbox_queue[BLOCK_NUMOF];
+static mbox_t _mbox = MBOX_INIT(_mbox_queue, BLOCK_NUMOF);
+
+static volatile unsigned _received;
+static unsigned _errors;
+
+static void _fill(uint8_t *block, unsigned seq)
+{
+    block[0] = seq;
+    block[BLOCK_SIZE - 1] = seq;
+}
+
+static void _check(const uint8_t *block, unsigned len)
+{
+    uint8_t seq = _received++;
+
+    if ((len != BLOCK_SIZE) || (block[0] != seq) ||
+        (block[BLOCK_SIZE - 1] != seq)) {
+        _errors++;
+    }
+}
+
+static void *_pipe_reader(void)
+{
+    for (unsigned i = 0; i < TRANSFERS; i++) {
+        size_t got = 0;
+        while (got < BLOCK_SIZE) {
+            got += pipe_read(&_pipe, _block_in + got, BLOCK_SIZE - got);
+        }
+        _check(_block_in, got);
+    }
+    return NULL;
+}
+
+static void *_mbox_reader(void)
+{
+    for (unsigned i = 0; i < TRANSFERS; i++) {
+        uint16_t len;
+        uint8_t *block = mbox_payload_get(&_mbox, &len);
+        _check(block, len);
+        mbox_payload_free(&_pool, block);
+    }
+    return NULL;
+}
+
+static void *_consumer(void *arg)
+{
+    return (arg == &_pipe) ? _pipe_reader() : _mbox_reader();
+}
+
+static void _pipe_writer(void)
+{
+    for (unsigned i = 0; i < TRANSFERS; i++) {
+        /* produce the block, then it is copied into the pipe */
+        _fill(_block_out, i);
+        pipe_write(&_pipe, _block_out, BLOCK_SIZE);
+    }
+}
+
+static void _mbox_writer(void)
+{
+    for (unsigned i = 0; i < TRANSFERS; i++) {
+        /* produce the block in place, then hand over the buffer */
+        uint8_t *block = mbox_payload_alloc(&_pool);
+        _fill(block, i);
+        mbox_payload_put(&_mbox, block, BLOCK_SIZE);
+    }
+}
+
+static void _run(const char *name, void *arg)
+{
+    _received = 0;
+
+    uint32_t start = xtimer_now_usec();
+    /* the consumer runs whenever there is data, as it has a higher
+     * priority, and ends once all blocks arrived */
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _consumer, arg, "consumer");
+    if (arg == &_pipe) {
+        _pipe_writer();
+    }
+    else {
+        _mbox_writer();
+    }
+    uint32_t us = xtimer_now_usec() - start;
+
+    if (_received != TRANSFERS) {
+        _errors++;
+    }
+    printf("%s: %u blocks of %u bytes in %" PRIu32 "us, %" PRIu32
+           " blocks/s\n", name, _received, BLOCK_SIZE, us,
+           (uint32_t)(((uint64_t)_received * US_PER_SEC) / (us ? us : 1)));
+}
+
+int main(void)
+{
+    puts("mbox payload test");
+
+    ringbuffer_init(&_rb, _pipe_buf, sizeof(_pipe_buf));
+    pipe_init(&_pipe, &_rb, NULL);
+    mbox_payload_pool_init(&_pool, _pool_queue, BLOCK_NUMOF, _pool_bufs,
+                           BLOCK_SIZE, BLOCK_NUMOF);
+
+    _run("pipe        ", &_pipe);
+    _run("mbox_payload", &_mbox);
+
+    puts(_errors ? "FAILURE" : "SUCCESS");
+
+    return 0;
+}
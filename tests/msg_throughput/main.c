@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares the message throughput of single and bulk IPC
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define MSG_NUMOF       (10000U)
+#define QUEUE_SIZE      (16U)
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[QUEUE_SIZE];
+
+static volatile unsigned _batch;
+static volatile unsigned _received;
+static volatile unsigned _errors;
+
+static void *_consumer(void *arg)
+{
+    (void)arg;
+    msg_t msgs[QUEUE_SIZE];
+
+    msg_init_queue(_queue, QUEUE_SIZE);
+
+    while (1) {
+        unsigned n;
+
+        if (_batch == 1) {
+            msg_receive(&msgs[0]);
+            n = 1;
+        }
+        else {
+            n = msg_receive_bulk(msgs, QUEUE_SIZE);
+        }
+        for (unsigned i = 0; i < n; i++) {
+            if (msgs[i].content.value != _received++) {
+                _errors++;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static void _run(kernel_pid_t pid, unsigned batch)
+{
+    msg_t msgs[QUEUE_SIZE];
+    unsigned seq = 0;
+
+    _batch = batch;
+    _received = 0;
+
+    uint32_t start = xtimer_now_usec();
+    if (batch == 1) {
+        msg_t m;
+        while (seq < MSG_NUMOF) {
+            m.content.value = seq++;
+            msg_send(&m, pid);
+        }
+    }
+    else {
+        while (seq < MSG_NUMOF) {
+            for (unsigned i = 0; i < batch; i++) {
+                msgs[i].content.value = seq + i;
+            }
+            int sent = msg_send_bulk(msgs, batch, pid);
+            if (sent <= 0) {
+                /* queue full, let the consumer catch up */
+                thread_yield();
+                continue;
+            }
+            seq += sent;
+        }
+    }
+    uint32_t us = xtimer_now_usec() - start;
+
+    printf("%s %2u: %u messages in %" PRIu32 "us, %" PRIu32 " msg/s\n",
+           (batch == 1) ? "single" : "bulk  ", batch, _received, us,
+           (uint32_t)(((uint64_t)_received * US_PER_SEC) / (us ? us : 1)));
+}
+
+int main(void)
+{
+    static const unsigned batches[] = { 1, 4, QUEUE_SIZE };
+
+    puts("msg throughput test");
+
+    /* the consumer preempts the producer, so every msg_send() costs two
+     * context switches, every msg_send_bulk() only two per batch */
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST,
+                                     _consumer, NULL, "consumer");
+
+    for (unsigned i = 0; i < sizeof(batches) / sizeof(batches[0]); i++) {
+        _run(pid, batches[i]);
+        if (_received != MSG_NUMOF) {
+            _errors++;
+        }
+    }
+
+    puts(_errors ? "FAILURE" : "SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the cost of mutex_lock() and mutex_lock_adaptive()
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mutex.h"
+#include "xtimer.h"
+
+#define UNCONTENDED_NUMOF   (100000U)
+#define CONTENDED_NUMOF     (100U)
+#define HOLD_US             (1000U)
+
+typedef void (*lock_t)(mutex_t *);
+
+static mutex_t _mutex = MUTEX_INIT;
+static volatile uint32_t _unlocked;
+
+static void _unlock_cb(void *arg)
+{
+    (void)arg;
+    _unlocked = xtimer_now_usec();
+    mutex_unlock(&_mutex);
+}
+
+static void _uncontended(const char *name, lock_t lock)
+{
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < UNCONTENDED_NUMOF; i++) {
+        lock(&_mutex);
+        mutex_unlock(&_mutex);
+    }
+
+    uint32_t us = xtimer_now_usec() - start;
+    printf("uncontended %s: %" PRIu32 "ns per lock/unlock\n", name,
+           (uint32_t)(((uint64_t)us * 1000) / UNCONTENDED_NUMOF));
+}
+
+/* the mutex is released from the timer interrupt, measures the time from
+ * the unlock until the thread owns the mutex */
+static void _contended(const char *name, lock_t lock)
+{
+    xtimer_t timer = { .callback = _unlock_cb };
+    uint32_t sum = 0;
+    uint32_t max = 0;
+
+    for (unsigned i = 0; i < CONTENDED_NUMOF; i++) {
+        mutex_lock(&_mutex);
+        xtimer_set(&timer, HOLD_US);
+        lock(&_mutex);
+        uint32_t us = xtimer_now_usec() - _unlocked;
+        mutex_unlock(&_mutex);
+
+        sum += us;
+        if (us > max) {
+            max = us;
+        }
+    }
+
+    printf("contended %s: %" PRIu32 "us average, %" PRIu32 "us max\n", name,
+           sum / CONTENDED_NUMOF, max);
+}
+
+/* mutex_lock() is inline, these give both variants the same call overhead */
+static void _lock(mutex_t *mutex)
+{
+    mutex_lock(mutex);
+}
+
+static void _lock_adaptive(mutex_t *mutex)
+{
+    mutex_lock_adaptive(mutex);
+}
+
+int main(void)
+{
+    puts("mutex latency benchmark");
+    printf("MUTEX_ADAPTIVE_SPINS: %u\n", MUTEX_ADAPTIVE_SPINS);
+
+    _uncontended("mutex_lock         ", _lock);
+    _uncontended("mutex_lock_adaptive", _lock_adaptive);
+    _contended("mutex_lock         ", _lock);
+    _contended("mutex_lock_adaptive", _lock_adaptive);
+
+    puts("done");
+
+    return 0;
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Reproduces priority inversion on a mutex
+ *
+ * A low priority thread holds a mutex a high priority thread waits for, while
+ * a medium priority thread keeps the CPU busy. Without priority inheritance
+ * the high priority thread waits for the medium priority thread to finish,
+ * with it only for the critical section of the low priority thread. The
+ * second scenario does the same with a chain of two mutexes. In the third,
+ * the high priority thread gives up waiting after a timeout, and the low
+ * priority thread has to drop the priority it inherited.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define CRITICAL_US     (10U * US_PER_MS)
+#define BUSY_US         (500U * US_PER_MS)
+/* allows for some scheduling and timer jitter */
+#define BOUND_US        (CRITICAL_US + (50U * US_PER_MS))
+#define TIMEOUT_US      (2U * US_PER_MS)
+
+#define PRIO_HIGH       (THREAD_PRIORITY_MAIN - 4)
+#define PRIO_MID        (THREAD_PRIORITY_MAIN - 3)
+#define PRIO_CHAIN      (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_LOW        (THREAD_PRIORITY_MAIN - 1)
+
+static char _stack_high[THREAD_STACKSIZE_MAIN];
+static char _stack_mid[THREAD_STACKSIZE_MAIN];
+static char _stack_chain[THREAD_STACKSIZE_MAIN];
+static char _stack_low[THREAD_STACKSIZE_MAIN];
+
+static mutex_t _mutex = MUTEX_INIT;
+static mutex_t _mutex_outer = MUTEX_INIT;
+
+static kernel_pid_t _high, _mid, _chain;
+static mutex_t *_high_mutex;
+static volatile bool _high_timeout;
+static volatile bool _high_locked;
+static volatile uint32_t _waited;
+static volatile bool _boosted, _restored;
+
+static void _busy(uint32_t us)
+{
+    uint32_t start = xtimer_now_usec();
+
+    while ((xtimer_now_usec() - start) < us) {}
+}
+
+static void *_high_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        mutex_t *mutex = _high_mutex;
+        uint32_t start = xtimer_now_usec();
+        if (_high_timeout) {
+            _high_locked = (xtimer_mutex_lock_timeout(mutex, TIMEOUT_US) == 0);
+        }
+        else {
+            mutex_lock(mutex);
+            _high_locked = true;
+        }
+        _waited = xtimer_now_usec() - start;
+        if (_high_locked) {
+            mutex_unlock(mutex);
+        }
+    }
+
+    return NULL;
+}
+
+static void *_mid_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        _busy(BUSY_US);
+    }
+
+    return NULL;
+}
+
+/* holds _mutex_outer while waiting for _mutex */
+static void *_chain_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        mutex_lock(&_mutex_outer);
+        mutex_lock(&_mutex);
+        mutex_unlock(&_mutex);
+        mutex_unlock(&_mutex_outer);
+    }
+
+    return NULL;
+}
+
+static void *_low_thread(void *arg)
+{
+    bool chain = (uintptr_t)arg;
+
+    mutex_lock(&_mutex);
+    if (chain) {
+        /* chain blocks on _mutex, high on _mutex_outer held by chain */
+        thread_wakeup(_chain);
+    }
+    /* high blocks on the mutex, then mid is ready to preempt us */
+    thread_wakeup(_high);
+    thread_wakeup(_mid);
+    _busy(CRITICAL_US);
+    mutex_unlock(&_mutex);
+
+    return NULL;
+}
+
+/* high gives up waiting for _mutex while we hold it */
+static void *_low_timeout_thread(void *arg)
+{
+    thread_t *me = (thread_t *)sched_active_thread;
+
+    (void)arg;
+    mutex_lock(&_mutex);
+    /* high blocks on the mutex */
+    thread_wakeup(_high);
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    _boosted = (me->priority == PRIO_HIGH);
+#else
+    _boosted = true;
+#endif
+    _busy(CRITICAL_US);
+    /* high timed out meanwhile, so nothing is left to inherit */
+    _restored = (me->priority == PRIO_LOW);
+    mutex_unlock(&_mutex);
+
+    return NULL;
+}
+
+static int _run_timeout(void)
+{
+    _waited = 0;
+    _high_mutex = &_mutex;
+    _high_timeout = true;
+    thread_create(_stack_low, sizeof(_stack_low), PRIO_LOW,
+                  THREAD_CREATE_STACKTEST, _low_timeout_thread, NULL, "low");
+    _high_timeout = false;
+
+    printf("timeout: high priority thread gave up after %" PRIu32 "us, "
+           "low priority thread %s\n", _waited,
+           (_boosted && _restored) ? "dropped inherited priority" :
+                                     "kept wrong priority");
+    return !_high_locked && (_waited >= TIMEOUT_US) && (_waited < BOUND_US) &&
+           _boosted && _restored;
+}
+
+static int _run(const char *name, bool chain)
+{
+    _waited = 0;
+    _high_mutex = chain ? &_mutex_outer : &_mutex;
+    thread_create(_stack_low, sizeof(_stack_low), PRIO_LOW,
+                  THREAD_CREATE_STACKTEST, _low_thread, (void *)(uintptr_t)chain,
+                  "low");
+
+    /* back here after all threads are done */
+    printf("%s: high priority thread waited %" PRIu32 "us\n", name, _waited);
+    return (_waited > 0) && (_waited < BOUND_US);
+}
+
+int main(void)
+{
+    puts("mutex priority inversion test");
+
+    _high = thread_create(_stack_high, sizeof(_stack_high), PRIO_HIGH,
+                          THREAD_CREATE_SLEEPING | THREAD_CREATE_STACKTEST,
+                          _high_thread, NULL, "high");
+    _mid = thread_create(_stack_mid, sizeof(_stack_mid), PRIO_MID,
+                         THREAD_CREATE_SLEEPING | THREAD_CREATE_STACKTEST,
+                         _mid_thread, NULL, "mid");
+    _chain = thread_create(_stack_chain, sizeof(_stack_chain), PRIO_CHAIN,
+                           THREAD_CREATE_SLEEPING | THREAD_CREATE_STACKTEST,
+                           _chain_thread, NULL, "chain");
+
+    /* first, so the other scenarios show the timeout left no stale state */
+    int ok = _run_timeout();
+    ok &= _run("direct", false);
+    ok &= _run("chain", true);
+
+    puts(ok ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares the throughput of the ringbuffer implementations
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ringbuffer.h"
+#include "spscrb.h"
+#include "tsrb.h"
+#include "xtimer.h"
+
+#define BUF_SIZE        (256U)
+#define CHUNK_MAX       (64U)
+#define TOTAL           (256U * 1024U)
+
+static char _buf[BUF_SIZE];
+static char _pattern[256 + CHUNK_MAX];
+static char _dst[CHUNK_MAX];
+
+static ringbuffer_t _ringbuffer;
+static tsrb_t _tsrb;
+static spscrb_t _spscrb;
+
+static unsigned _errors;
+
+typedef struct {
+    const char *name;
+    void (*init)(void);
+    unsigned (*add)(const char *src, unsigned n);
+    unsigned (*get)(char *dst, unsigned n);
+} impl_t;
+
+static void _ringbuffer_init(void)
+{
+    ringbuffer_init(&_ringbuffer, _buf, sizeof(_buf));
+}
+
+static unsigned _ringbuffer_add(const char *src, unsigned n)
+{
+    return ringbuffer_add(&_ringbuffer, src, n);
+}
+
+static unsigned _ringbuffer_get(char *dst, unsigned n)
+{
+    return ringbuffer_get(&_ringbuffer, dst, n);
+}
+
+static void _tsrb_init(void)
+{
+    tsrb_init(&_tsrb, _buf, sizeof(_buf));
+}
+
+static unsigned _tsrb_add(const char *src, unsigned n)
+{
+    return tsrb_add(&_tsrb, src, n);
+}
+
+static unsigned _tsrb_get(char *dst, unsigned n)
+{
+    return tsrb_get(&_tsrb, dst, n);
+}
+
+static void _spscrb_init(void)
+{
+    spscrb_init(&_spscrb, _buf, sizeof(_buf));
+}
+
+static unsigned _spscrb_add(const char *src, unsigned n)
+{
+    return spscrb_add(&_spscrb, src, n);
+}
+
+static unsigned _spscrb_get(char *dst, unsigned n)
+{
+    return spscrb_get(&_spscrb, dst, n);
+}
+
+/* zero-copy variant, the data is produced and checked in place */
+static unsigned _spscrb_span_add(const char *src, unsigned n)
+{
+    unsigned done = 0;
+    uint8_t *span;
+    size_t len;
+
+    while ((done < n) && (len = spscrb_reserve_span(&_spscrb, &span))) {
+        if (len > (n - done)) {
+            len = n - done;
+        }
+        memcpy(span, src + done, len);
+        spscrb_commit(&_spscrb, len);
+        done += len;
+    }
+    return done;
+}
+
+static unsigned _spscrb_span_get(char *dst, unsigned n)
+{
+    unsigned done = 0;
+    const uint8_t *span;
+    size_t len;
+
+    while ((done < n) && (len = spscrb_peek_span(&_spscrb, &span))) {
+        if (len > (n - done)) {
+            len = n - done;
+        }
+        memcpy(dst + done, span, len);
+        spscrb_consume(&_spscrb, len);
+        done += len;
+    }
+    return done;
+}
+
+static const impl_t _impls[] = {
+    { "ringbuffer ", _ringbuffer_init, _ringbuffer_add, _ringbuffer_get },
+    { "tsrb       ", _tsrb_init, _tsrb_add, _tsrb_get },
+    { "spscrb     ", _spscrb_init, _spscrb_add, _spscrb_get },
+    { "spscrb span", _spscrb_init, _spscrb_span_add, _spscrb_span_get },
+};
+
+static void _run(const impl_t *impl, unsigned chunk)
+{
+    /* the data stream is a byte counter, _pattern + (pos % 256) holds the
+     * next chunk at stream position pos */
+    unsigned pos_w = BUF_SIZE / 2;
+    unsigned pos_r = 0;
+
+    impl->init();
+    /* keep the buffer half full, so chunks regularly wrap around */
+    impl->add(_pattern, pos_w);
+
+    uint32_t start = xtimer_now_usec();
+    for (unsigned done = 0; done < TOTAL; done += chunk) {
+        if ((impl->add(&_pattern[pos_w % 256], chunk) != chunk) ||
+            (impl->get(_dst, chunk) != chunk) ||
+            (memcmp(_dst, &_pattern[pos_r % 256], chunk) != 0)) {
+            _errors++;
+        }
+        pos_w += chunk;
+        pos_r += chunk;
+    }
+    uint32_t us = xtimer_now_usec() - start;
+
+    printf("%s chunk %2u: %6" PRIu32 " KiB/s\n", impl->name, chunk,
+           (uint32_t)(((uint64_t)TOTAL * US_PER_SEC) / 1024 / (us ? us : 1)));
+}
+
+int main(void)
+{
+    static const unsigned chunks[] = { 1, 16, CHUNK_MAX };
+
+    puts("ringbuffer throughput test");
+
+    for (unsigned i = 0; i < sizeof(_pattern); i++) {
+        _pattern[i] = i;
+    }
+
+    for (unsigned c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+        for (unsigned i = 0; i < sizeof(_impls) / sizeof(_impls[0]); i++) {
+            _run(&_impls[i], chunks[c]);
+        }
+    }
+
+    puts(_errors ? "FAILURE" : "SUCCESS");
+
+    return 0;
+}
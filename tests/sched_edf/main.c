@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for EDF scheduling
+ *
+ * Two periodic control loops run as EDF threads next to a "network" thread
+ * with a fixed priority that is kept busy by a timer. The control loops have
+ * to meet all of their deadlines. Before, main holds a mutex an EDF thread
+ * waits for and has to inherit its priority and deadline.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "sched_edf.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define NET_INTERVAL    (5U * US_PER_MS)
+#define NET_WORK        (4U * US_PER_MS)
+#define NET_QUEUE_SIZE  (8)
+
+typedef struct {
+    const char *name;
+    uint32_t period;
+    uint32_t deadline;
+    uint32_t wcet;
+    uint32_t work;              /* actual time spent per job */
+    unsigned jobs;
+    unsigned misses;
+    volatile bool done;
+    char stack[THREAD_STACKSIZE_DEFAULT];
+} ctrl_t;
+
+static ctrl_t _ctrl[] = {
+    { .name = "ctrl_a", .period = 10000, .deadline = 10000, .wcet = 3000,
+      .work = 2000, .jobs = 200 },
+    { .name = "ctrl_b", .period = 25000, .deadline = 20000, .wcet = 8000,
+      .work = 6000, .jobs = 80 },
+};
+
+#define CTRL_NUMOF      (sizeof(_ctrl) / sizeof(_ctrl[0]))
+
+static char _net_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _net_queue[NET_QUEUE_SIZE];
+static unsigned _net_packets;
+
+static char _waiter_stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _mutex = MUTEX_INIT;
+static uint32_t _waiter_deadline;
+
+static bool _ctrl_done(void)
+{
+    for (unsigned i = 0; i < CTRL_NUMOF; i++) {
+        if (!_ctrl[i].done) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void *_ctrl_thread(void *arg)
+{
+    ctrl_t *ctrl = arg;
+    sched_edf_t edf;
+
+    if (sched_edf_enter(&edf, ctrl->period, ctrl->deadline, ctrl->wcet) < 0) {
+        printf("%s: not admitted\n", ctrl->name);
+        ctrl->done = true;
+        return NULL;
+    }
+
+    for (unsigned i = 0; i < ctrl->jobs; i++) {
+        xtimer_spin(xtimer_ticks_from_usec(ctrl->work));
+        sched_edf_wait(&edf);
+    }
+
+    sched_edf_leave(&edf);
+    ctrl->jobs = edf.jobs;
+    ctrl->misses = edf.misses;
+    ctrl->done = true;
+
+    return NULL;
+}
+
+static void *_net_thread(void *arg)
+{
+    (void)arg;
+
+    xtimer_t timer;
+    msg_t msg;
+
+    msg_init_queue(_net_queue, NET_QUEUE_SIZE);
+
+    while (!_ctrl_done()) {
+        xtimer_set_msg(&timer, NET_INTERVAL, &msg, thread_getpid());
+        msg_receive(&msg);
+        /* "process a packet" */
+        xtimer_spin(xtimer_ticks_from_usec(NET_WORK));
+        _net_packets++;
+    }
+
+    return NULL;
+}
+
+static void *_waiter_thread(void *arg)
+{
+    sched_edf_t edf;
+
+    (void)arg;
+
+    if (sched_edf_enter(&edf, 10000, 10000, 1000) < 0) {
+        puts("waiter: not admitted");
+        return NULL;
+    }
+    _waiter_deadline = sched_active_thread->edf_deadline;
+    mutex_lock(&_mutex);
+    mutex_unlock(&_mutex);
+    sched_edf_leave(&edf);
+
+    return NULL;
+}
+
+static int _test_inheritance(void)
+{
+    thread_t *me = (thread_t *)sched_active_thread;
+    int res = 0;
+
+    mutex_lock(&_mutex);
+    /* runs right away, enters EDF and blocks on the mutex */
+    thread_create(_waiter_stack, sizeof(_waiter_stack),
+                  THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_STACKTEST,
+                  _waiter_thread, NULL, "waiter");
+    if ((me->priority != SCHED_EDF_PRIORITY) ||
+        (me->edf_deadline != _waiter_deadline)) {
+        res = 1;
+    }
+    mutex_unlock(&_mutex);
+    if ((me->priority != THREAD_PRIORITY_MAIN) ||
+        (me->edf_deadline != me->edf_base_deadline)) {
+        res = 1;
+    }
+
+    puts(res ? "inheritance: failed" : "inheritance: ok");
+    return res;
+}
+
+int main(void)
+{
+    sched_edf_t edf;
+    int res = 0;
+
+    puts("EDF scheduling test");
+
+    res = _test_inheritance();
+
+    for (unsigned i = 0; i < CTRL_NUMOF; i++) {
+        thread_create(_ctrl[i].stack, sizeof(_ctrl[i].stack),
+                      THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_STACKTEST,
+                      _ctrl_thread, &_ctrl[i], _ctrl[i].name);
+    }
+
+    /* the control loops use 70% already */
+    if (sched_edf_enter(&edf, 10000, 10000, 5000) == -EBUSY) {
+        puts("admission: rejected");
+    }
+    else {
+        puts("admission: accepted");
+        sched_edf_leave(&edf);
+        res = 1;
+    }
+
+    thread_create(_net_stack, sizeof(_net_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _net_thread, NULL, "net");
+
+    /* the net thread keeps main from running until the control loops are
+     * done */
+    while (!_ctrl_done()) {
+        xtimer_usleep(100U * US_PER_MS);
+    }
+
+    printf("net: %u packets\n", _net_packets);
+    for (unsigned i = 0; i < CTRL_NUMOF; i++) {
+        printf("%s: %u jobs, %u misses\n", _ctrl[i].name, _ctrl[i].jobs,
+               _ctrl[i].misses);
+        if (_ctrl[i].misses) {
+            res = 1;
+        }
+    }
+
+    puts(res ? "FAILURE" : "SUCCESS");
+
+    return res;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+
+def testfunc(child):
+    child.expect_exact(u"inheritance: ok")
+    child.expect_exact(u"admission: rejected")
+    child.expect(r"net: \d+ packets")
+    child.expect_exact(u"ctrl_a: 200 jobs, 0 misses")
+    child.expect_exact(u"ctrl_b: 80 jobs, 0 misses")
+    child.expect_exact(u"SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc))
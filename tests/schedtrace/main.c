@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the scheduler trace
+ *
+ * Records a message exchange and a contended mutex, then parses the export
+ * and checks its header, the thread names and the recorded events. Also
+ * checks that the ring buffer keeps the newest events in order and that no
+ * events are recorded during an export.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "schedtrace.h"
+#include "thread.h"
+
+#define EXPORT_SIZE     (sizeof(schedtrace_hdr_t) + \
+                         (KERNEL_PID_LAST + 1) * (2 + 16) + \
+                         SCHEDTRACE_SIZE * sizeof(schedtrace_event_t))
+#define EXTRA_EVENTS    (10U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _mutex = MUTEX_INIT;
+static kernel_pid_t _pong_pid;
+
+static uint8_t _export[EXPORT_SIZE];
+static size_t _export_len;
+static bool _add_during_export;
+
+static void *_pong(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    msg_receive(&msg);
+    msg_reply(&msg, &msg);
+    /* blocks until main unlocks */
+    mutex_lock(&_mutex);
+    mutex_unlock(&_mutex);
+    return NULL;
+}
+
+static int _write(const void *data, size_t len, void *arg)
+{
+    (void)arg;
+    if ((_export_len + len) > sizeof(_export)) {
+        return -1;
+    }
+    memcpy(&_export[_export_len], data, len);
+    _export_len += len;
+    if (_add_during_export) {
+        schedtrace_add(SCHEDTRACE_MSG_SEND, thread_getpid(), 0xffff);
+    }
+    return 0;
+}
+
+/* exports the trace, checks the header and the thread names and returns the
+ * events or NULL on error */
+static const schedtrace_event_t *_export_events(unsigned *numof)
+{
+    schedtrace_hdr_t hdr;
+    size_t pos = sizeof(hdr);
+    int res;
+
+    _export_len = 0;
+    res = schedtrace_export(_write, NULL);
+    if (res < 0) {
+        puts("export failed");
+        return NULL;
+    }
+    memcpy(&hdr, _export, sizeof(hdr));
+    if ((hdr.magic != SCHEDTRACE_MAGIC) || (hdr.version != SCHEDTRACE_VERSION) ||
+        (hdr.event_size != sizeof(schedtrace_event_t)) ||
+        (hdr.numof != (unsigned)res) || (hdr.isr_pid != (uint8_t)KERNEL_PID_ISR)) {
+        puts("invalid header");
+        return NULL;
+    }
+
+    bool found_pong = false;
+
+    for (unsigned i = 0; i < hdr.threads; i++) {
+        uint8_t pid = _export[pos];
+        uint8_t len = _export[pos + 1];
+
+        if ((pid > KERNEL_PID_LAST) || (thread_get(pid) == NULL)) {
+            puts("invalid thread entry");
+            return NULL;
+        }
+#ifdef DEVELHELP
+        if ((len != strlen(thread_getname(pid))) ||
+            (memcmp(&_export[pos + 2], thread_getname(pid), len) != 0)) {
+            puts("invalid thread name");
+            return NULL;
+        }
+#endif
+        found_pong |= (pid == _pong_pid);
+        pos += 2 + len;
+    }
+    if (!found_pong ||
+        (_export_len != pos + hdr.numof * sizeof(schedtrace_event_t))) {
+        puts("invalid export length");
+        return NULL;
+    }
+    *numof = hdr.numof;
+    return (const schedtrace_event_t *)&_export[pos];
+}
+
+static int _find(const schedtrace_event_t *events, unsigned numof,
+                 unsigned start, schedtrace_type_t type, kernel_pid_t pid,
+                 uint16_t arg)
+{
+    for (unsigned i = start; i < numof; i++) {
+        if ((events[i].type == type) && (events[i].pid == pid) &&
+            (events[i].arg == arg)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int _test_events(void)
+{
+    kernel_pid_t me = thread_getpid();
+    const schedtrace_event_t *events;
+    unsigned numof;
+    uint16_t mutex_id = (uint16_t)(uintptr_t)&_mutex;
+    msg_t msg;
+    int pos;
+
+    mutex_lock(&_mutex);
+    schedtrace_clear();
+    _pong_pid = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                              THREAD_CREATE_STACKTEST, _pong, NULL, "pong");
+    msg_send_receive(&msg, &msg, _pong_pid);
+    mutex_unlock(&_mutex);
+
+    events = _export_events(&numof);
+    if (events == NULL) {
+        return -1;
+    }
+    for (unsigned i = 1; i < numof; i++) {
+        if ((int32_t)(events[i].time - events[i - 1].time) < 0) {
+            puts("events out of order");
+            return -1;
+        }
+    }
+    /* main sends, pong runs, receives and replies, then pong blocks on the
+     * mutex, main gets the reply and wakes pong up */
+    if (((pos = _find(events, numof, 0, SCHEDTRACE_MSG_SEND, me, _pong_pid)) < 0) ||
+        ((pos = _find(events, numof, pos, SCHEDTRACE_SWITCH, _pong_pid, me)) < 0) ||
+        ((pos = _find(events, numof, pos, SCHEDTRACE_MSG_RECEIVE, _pong_pid, me)) < 0) ||
+        ((pos = _find(events, numof, pos, SCHEDTRACE_MSG_SEND, _pong_pid, me)) < 0) ||
+        ((pos = _find(events, numof, pos, SCHEDTRACE_MUTEX_BLOCK, _pong_pid, mutex_id)) < 0) ||
+        ((pos = _find(events, numof, pos, SCHEDTRACE_MSG_RECEIVE, me, _pong_pid)) < 0) ||
+        ((pos = _find(events, numof, pos, SCHEDTRACE_MUTEX_UNBLOCK, _pong_pid, mutex_id)) < 0)) {
+        puts("missing events");
+        return -1;
+    }
+    printf("events: %u events exported\n", numof);
+    return 0;
+}
+
+static int _test_ring(void)
+{
+    kernel_pid_t me = thread_getpid();
+    const schedtrace_event_t *events;
+    unsigned numof;
+
+    schedtrace_clear();
+    for (unsigned i = 0; i < SCHEDTRACE_SIZE + EXTRA_EVENTS; i++) {
+        schedtrace_add(SCHEDTRACE_MSG_SEND, me, i);
+    }
+    if (schedtrace_numof() != SCHEDTRACE_SIZE) {
+        puts("ring buffer not full");
+        return -1;
+    }
+
+    _add_during_export = true;
+    events = _export_events(&numof);
+    _add_during_export = false;
+    if ((events == NULL) || (numof != SCHEDTRACE_SIZE)) {
+        return -1;
+    }
+    /* the oldest events were overwritten, none were added by _write() */
+    for (unsigned i = 0; i < numof; i++) {
+        if ((events[i].type != SCHEDTRACE_MSG_SEND) || (events[i].pid != me) ||
+            (events[i].arg != i + EXTRA_EVENTS)) {
+            printf("unexpected event %u\n", i);
+            return -1;
+        }
+    }
+
+    schedtrace_add(SCHEDTRACE_MSG_SEND, me, SCHEDTRACE_SIZE);
+    events = _export_events(&numof);
+    if ((events == NULL) || (events[numof - 1].arg != SCHEDTRACE_SIZE)) {
+        puts("recording not resumed after export");
+        return -1;
+    }
+    puts("ring: kept the newest events");
+    return 0;
+}
+
+int main(void)
+{
+    puts("schedtrace test");
+
+    if (_test_events() < 0) {
+        puts("FAILURE: recorded events do not match");
+        return 1;
+    }
+    if (_test_ring() < 0) {
+        puts("FAILURE: ring buffer does not match");
+        return 1;
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for thread_flags_msg_wait_any()
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#define FLAG_A          (0x1)
+#define FLAG_B          (0x2)
+#define FLAG_GO         (0x4)
+#define MSG_QUEUE_SIZE  (4)
+
+static char stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[MSG_QUEUE_SIZE];
+
+static volatile unsigned done;
+
+static void _wait(const char *what)
+{
+    msg_t msg;
+    thread_flags_t flags = thread_flags_msg_wait_any(FLAG_A | FLAG_B, &msg);
+
+    if (flags) {
+        printf("thread(): %s: flags 0x%04x\n", what, (unsigned)flags);
+    }
+    else {
+        printf("thread(): %s: msg 0x%04x\n", what, (unsigned)msg.type);
+    }
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+
+    msg_init_queue(_queue, MSG_QUEUE_SIZE);
+
+    /* woken up by a message while blocked */
+    _wait("blocked");
+    /* woken up by a flag while blocked */
+    _wait("blocked");
+
+    /* wait until main() queued a message and set a flag */
+    thread_flags_wait_any(FLAG_GO);
+
+    /* flags are returned first, then the queued messages */
+    _wait("pending");
+    _wait("pending");
+
+    done = 1;
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    kernel_pid_t pid = thread_create(stack, sizeof(stack),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST,
+                                     _thread, NULL, "waiter");
+    thread_t *thread = (thread_t *)thread_get(pid);
+    msg_t msg;
+
+    puts("main(): sending msg 0x0001");
+    msg.type = 0x0001;
+    msg_send(&msg, pid);
+
+    puts("main(): setting flag 0x0002");
+    thread_flags_set(thread, FLAG_B);
+
+    /* the waiter is blocked on a plain flag now, so this only gets queued */
+    puts("main(): sending msg 0x0002");
+    msg.type = 0x0002;
+    msg_send(&msg, pid);
+    puts("main(): setting flag 0x0001");
+    thread_flags_set(thread, FLAG_A);
+    thread_flags_set(thread, FLAG_GO);
+
+    while (!done) {}
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+
+def testfunc(child):
+    child.expect_exact(u"main(): sending msg 0x0001")
+    child.expect_exact(u"thread(): blocked: msg 0x0001")
+    child.expect_exact(u"main(): setting flag 0x0002")
+    child.expect_exact(u"thread(): blocked: flags 0x0002")
+    child.expect_exact(u"main(): sending msg 0x0002")
+    child.expect_exact(u"main(): setting flag 0x0001")
+    child.expect_exact(u"thread(): pending: flags 0x0001")
+    child.expect_exact(u"thread(): pending: msg 0x0002")
+    child.expect_exact(u"SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc))
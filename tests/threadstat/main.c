@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the threadstat module
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "saul_reg.h"
+#include "thread.h"
+#include "threadstat.h"
+#include "xtimer.h"
+
+#define PERIOD          (100U * US_PER_MS)
+#define BUSY            (30U * US_PER_MS)
+#define SAMPLES         (3U)
+#define STACK_BUF_SIZE  (256U)
+
+static char stack[THREAD_STACKSIZE_MAIN];
+
+static void _use_stack(void)
+{
+    volatile char buf[STACK_BUF_SIZE];
+
+    memset((char *)buf, 0xaa, sizeof(buf));
+}
+
+static void *_busy(void *arg)
+{
+    (void)arg;
+
+    _use_stack();
+    xtimer_ticks32_t last = xtimer_now();
+    while (1) {
+        xtimer_spin(xtimer_ticks_from_usec(BUSY));
+        xtimer_periodic_wakeup(&last, PERIOD);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    threadstat_t stat;
+    phydat_t res;
+
+    puts("threadstat test application");
+
+    kernel_pid_t pid = thread_create(stack, sizeof(stack),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST,
+                                     _busy, NULL, "busy");
+
+    xtimer_usleep((SAMPLES * THREADSTAT_INTERVAL) + (THREADSTAT_INTERVAL / 2));
+
+    if (threadstat_get(pid, &stat) != 0) {
+        puts("FAILURE: no statistics for busy thread");
+        return 1;
+    }
+    printf("busy: load %u.%02u%% (1), stack %u/%u\n",
+           stat.load[THREADSTAT_LOAD_1] / 100,
+           stat.load[THREADSTAT_LOAD_1] % 100,
+           stat.stack_used, stat.stack_size);
+
+    saul_reg_t *dev = saul_reg_find_type(SAUL_SENSE_CPU);
+    if ((dev == NULL) || (saul_reg_read(dev, &res) != THREADSTAT_LOAD_NUMOF)) {
+        puts("FAILURE: no CPU load sensor");
+        return 1;
+    }
+    printf("cpu: ");
+    phydat_dump(&res, THREADSTAT_LOAD_NUMOF);
+
+    /* the busy thread spins 30% of the time */
+    if ((stat.load[THREADSTAT_LOAD_1] < 2500) ||
+        (stat.load[THREADSTAT_LOAD_1] > 3500) ||
+        (res.val[THREADSTAT_LOAD_1] < stat.load[THREADSTAT_LOAD_1])) {
+        puts("FAILURE: unexpected CPU load");
+        return 1;
+    }
+#ifdef DEVELHELP
+    if (stat.stack_used < STACK_BUF_SIZE) {
+        puts("FAILURE: stack high-water mark too low");
+        return 1;
+    }
+#endif
+
+    puts("SUCCESS");
+
+    return 0;
+}
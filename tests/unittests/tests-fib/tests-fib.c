@@ -21,10 +21,17 @@
 
 #define TEST_FIB_TABLE_SIZE (20)
 static fib_entry_t _entries[TEST_FIB_TABLE_SIZE];
+#ifdef MODULE_FIB_TRIE
+static fib_trie_node_t _trie_pool[FIB_TRIE_POOL_SIZE(TEST_FIB_TABLE_SIZE)];
+#endif
 static fib_table_t test_fib_table = { .data.entries = _entries,
                                       .table_type = FIB_TABLE_TYPE_SH,
                                       .size = TEST_FIB_TABLE_SIZE,
                                       .mtx_access = MUTEX_INIT,
+#ifdef MODULE_FIB_TRIE
+                                      .trie_pool = _trie_pool,
+                                      .trie_pool_size = FIB_TRIE_POOL_SIZE(TEST_FIB_TABLE_SIZE),
+#endif
                                       .notify_rp_pos = 0 };
 
 /*
@@ -978,6 +985,159 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief helper to add a route for the 16 byte destination dst with the given
+*        prefix length towards the next-hop 0x01..0x10 + nh
+*/
+static void _add_route(const uint8_t *dst, uint32_t prefix_len, uint8_t nh,
+                       uint32_t lifetime)
+{
+    uint8_t addr_nxt[16];
+
+    for (size_t i = 0; i < sizeof(addr_nxt); i++) {
+        addr_nxt[i] = i + 1 + nh;
+    }
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, (uint8_t *)dst,
+                                           16, ((prefix_len << FIB_FLAG_NET_PREFIX_SHIFT) | 0x123),
+                                           addr_nxt, sizeof(addr_nxt), 0x23,
+                                           lifetime));
+}
+
+/*
+* @brief helper to look up the 16 byte destination dst, returns the result of
+*        fib_get_next_hop() and the next-hop number in nh
+*/
+static int _lookup_route(const uint8_t *dst, uint8_t *nh)
+{
+    uint8_t addr_nxt_hop[16];
+    size_t add_buf_size = sizeof(addr_nxt_hop);
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+    int ret;
+
+    memset(addr_nxt_hop, 0, sizeof(addr_nxt_hop));
+    ret = fib_get_next_hop(&test_fib_table, &iface_id, addr_nxt_hop,
+                           &add_buf_size, &next_hop_flags, (uint8_t *)dst,
+                           16, 0x123);
+    *nh = addr_nxt_hop[0] - 1;
+    return ret;
+}
+
+/* ::/0 */
+static const uint8_t _route_default[16] = { 0 };
+/* 2001:db8::/32 */
+static const uint8_t _route_32[16] = { 0x20, 0x01, 0x0d, 0xb8 };
+/* 2001:db8:0:1::/64 */
+static const uint8_t _route_64a[16] = { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 1 };
+/* 2001:db8:0:2::/64 */
+static const uint8_t _route_64b[16] = { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 2 };
+/* 2001:db8:0:1::42 */
+static const uint8_t _route_host[16] = { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 1,
+                                         0, 0, 0, 0, 0, 0, 0, 0x42 };
+
+/*
+* @brief testing that the longest of several overlapping prefixes matches
+*/
+static void test_fib_21_longest_prefix_match(void)
+{
+    uint8_t addr_lookup[16];
+    uint8_t nh = 0;
+
+    /* add them out of order, so the position in the table doesn't matter */
+    _add_route(_route_64a, 64, 2, 100000);
+    _add_route(_route_default, 0, 0, 100000);
+    _add_route(_route_host, 128, 3, 100000);
+    _add_route(_route_32, 32, 1, 100000);
+    _add_route(_route_64b, 64, 4, 100000);
+
+    /* the host route is an exact match */
+    TEST_ASSERT_EQUAL_INT(0, _lookup_route(_route_host, &nh));
+    TEST_ASSERT_EQUAL_INT(3, nh);
+
+    /* its neighbour only matches the covering /64 */
+    memcpy(addr_lookup, _route_host, sizeof(addr_lookup));
+    addr_lookup[15] = 0x43;
+    TEST_ASSERT_EQUAL_INT(0, _lookup_route(addr_lookup, &nh));
+    TEST_ASSERT_EQUAL_INT(2, nh);
+
+    /* the sibling /64 is as long as the first one and must win */
+    memcpy(addr_lookup, _route_64b, sizeof(addr_lookup));
+    addr_lookup[15] = 0x01;
+    TEST_ASSERT_EQUAL_INT(0, _lookup_route(addr_lookup, &nh));
+    TEST_ASSERT_EQUAL_INT(4, nh);
+
+    /* an address outside both /64s falls back to the /32 */
+    addr_lookup[7] = 3;
+    TEST_ASSERT_EQUAL_INT(0, _lookup_route(addr_lookup, &nh));
+    TEST_ASSERT_EQUAL_INT(1, nh);
+
+    /* and one outside the /32 to the default route */
+    addr_lookup[3] = 0xb9;
+    TEST_ASSERT_EQUAL_INT(0, _lookup_route(addr_lookup, &nh));
+    TEST_ASSERT_EQUAL_INT(0, nh);
+
+    fib_deinit(&test_fib_table);
+}
+
+/*
+* @brief testing the fallback to and the removal of the default route
+*/
+static void test_fib_22_default_route_fallback(void)
+{
+    uint8_t addr_lookup[16];
+    uint8_t nh = 0;
+
+    _add_route(_route_default, 0, 0, 100000);
+    _add_route(_route_32, 32, 1, 100000);
+
+    memcpy(addr_lookup, _route_32, sizeof(addr_lookup));
+    addr_lookup[15] = 0x01;
+    TEST_ASSERT_EQUAL_INT(0, _lookup_route(addr_lookup, &nh));
+    TEST_ASSERT_EQUAL_INT(1, nh);
+
+    /* without the prefix the default route takes over */
+    fib_remove_entry(&test_fib_table, (uint8_t *)_route_32, 16);
+    TEST_ASSERT_EQUAL_INT(0, _lookup_route(addr_lookup, &nh));
+    TEST_ASSERT_EQUAL_INT(0, nh);
+
+    /* and without any route the destination is unreachable */
+    fib_remove_entry(&test_fib_table, (uint8_t *)_route_default, 16);
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, _lookup_route(addr_lookup, &nh));
+    TEST_ASSERT_EQUAL_INT(0, fib_get_num_used_entries(&test_fib_table));
+
+    fib_deinit(&test_fib_table);
+}
+
+/*
+* @brief testing that expired routes are no longer used
+*/
+static void test_fib_23_expired_routes(void)
+{
+    uint8_t addr_lookup[16];
+    uint8_t nh = 0;
+
+    _add_route(_route_default, 0, 0, (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+    _add_route(_route_32, 32, 1, 20);
+    _add_route(_route_64a, 64, 2, 10);
+
+    memcpy(addr_lookup, _route_host, sizeof(addr_lookup));
+    TEST_ASSERT_EQUAL_INT(0, _lookup_route(addr_lookup, &nh));
+    TEST_ASSERT_EQUAL_INT(2, nh);
+
+    /* the /64 expires first */
+    xtimer_usleep(15 * US_PER_MS);
+    TEST_ASSERT_EQUAL_INT(0, _lookup_route(addr_lookup, &nh));
+    TEST_ASSERT_EQUAL_INT(1, nh);
+
+    /* then the /32, the default route never does */
+    xtimer_usleep(10 * US_PER_MS);
+    TEST_ASSERT_EQUAL_INT(0, _lookup_route(addr_lookup, &nh));
+    TEST_ASSERT_EQUAL_INT(0, nh);
+    TEST_ASSERT_EQUAL_INT(1, fib_get_num_used_entries(&test_fib_table));
+
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1002,6 +1162,9 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_longest_prefix_match),
+                        new_TestFixture(test_fib_22_default_route_fallback),
+                        new_TestFixture(test_fib_23_expired_routes),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
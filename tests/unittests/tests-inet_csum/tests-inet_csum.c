@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,103 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* the byte-wise implementation inet_csum_slice() had before it used word
+ * access */
+static uint16_t _csum_slice_bytewise(uint16_t sum, const uint8_t *buf,
+                                     uint16_t len, size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+    for (int i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__compare_bytewise(void)
+{
+    static const uint16_t sums[] = { 0x0000, 0xffff, 0x1785 };
+    uint8_t data[96];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)((i * 0x9d) ^ 0x5a);
+    }
+    /* all alignments, lengths, and parities of the accumulated length */
+    for (unsigned offset = 0; offset < 4; offset++) {
+        for (unsigned len = 0; len <= (sizeof(data) - offset); len++) {
+            for (unsigned accum_len = 0; accum_len < 2; accum_len++) {
+                for (unsigned i = 0; i < (sizeof(sums) / sizeof(sums[0])); i++) {
+                    TEST_ASSERT_EQUAL_INT(
+                        _csum_slice_bytewise(sums[i], data + offset, len,
+                                             accum_len),
+                        inet_csum_slice(sums[i], data + offset, len,
+                                        accum_len));
+                }
+            }
+        }
+    }
+}
+
+static void test_inet_csum__all_ones(void)
+{
+    /* stresses the carry handling of the accumulator */
+    uint8_t data[1024];
+
+    memset(data, 0xff, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(0xffff, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(0, data + 1, sizeof(data) - 2));
+}
+
+static void test_inet_csum__update16(void)
+{
+    /* same header as in test_inet_csum__calculate_csum() */
+    uint8_t data[] = {
+        0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00,
+        0x40, 0x11, 0x00, 0x00, 0xc0, 0xa8, 0x00, 0x01,
+        0xc0, 0xa8, 0x00, 0xc7,
+    };
+    uint16_t csum = ~inet_csum(0, data, sizeof(data));
+
+    TEST_ASSERT_EQUAL_INT(0xb861, csum);
+    /* decrement TTL */
+    csum = inet_csum_update16(csum, 0x4011, 0x3f11);
+    data[8] = 0x3f;
+    TEST_ASSERT_EQUAL_INT((uint16_t)~inet_csum(0, data, sizeof(data)), csum);
+}
+
+static void test_inet_csum__update(void)
+{
+    uint8_t data[] = {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xc8, 0x86, 0xcd, 0xff, 0xfe, 0x0f, 0xce, 0x49,
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x18, 0xaa, 0x2d, 0xff, 0xfe, 0x44, 0x43, 0xac
+    };
+    uint8_t old[8];
+    uint16_t csum = ~inet_csum(0, data, sizeof(data));
+
+    /* rewrite an interface identifier */
+    memcpy(old, &data[8], sizeof(old));
+    memset(&data[8], 0xa5, sizeof(old));
+    csum = inet_csum_update(csum, old, &data[8], sizeof(old));
+    TEST_ASSERT_EQUAL_INT((uint16_t)~inet_csum(0, data, sizeof(data)), csum);
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +274,10 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__compare_bytewise),
+        new_TestFixture(test_inet_csum__all_ones),
+        new_TestFixture(test_inet_csum__update16),
+        new_TestFixture(test_inet_csum__update),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
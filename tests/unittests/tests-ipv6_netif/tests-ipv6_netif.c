@@ -14,6 +14,7 @@
 #include <errno.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit/embUnit.h"
 
@@ -476,6 +477,192 @@ static void test_ipv6_netif_find_best_src_addr__other_subnet(void)
     TEST_ASSERT_EQUAL_INT(true, ipv6_addr_equal(out, &addr1));
 }
 
+/* the source address selection of gnrc_ipv6_netif_find_best_src_addr() as it
+ * was before it was precomputed: rule by rule over all addresses */
+static uint8_t _ref_get_scope(const ipv6_addr_t *addr, bool maybe_multicast)
+{
+    if (maybe_multicast && ipv6_addr_is_multicast(addr)) {
+        return (addr->u8[1] & 0x0f);
+    }
+    else if (ipv6_addr_is_link_local(addr)) {
+        return IPV6_ADDR_MCAST_SCP_LINK_LOCAL;
+    }
+    else if (ipv6_addr_is_site_local(addr)) {
+        return IPV6_ADDR_MCAST_SCP_SITE_LOCAL;
+    }
+    return IPV6_ADDR_MCAST_SCP_GLOBAL;
+}
+
+static ipv6_addr_t *_ref_find_best_src_addr(kernel_pid_t pid, const ipv6_addr_t *dst,
+                                            bool ll_only)
+{
+    gnrc_ipv6_netif_t *iface = gnrc_ipv6_netif_get(pid);
+    uint8_t points[GNRC_IPV6_NETIF_ADDR_NUMOF];
+    uint8_t dst_scope = _ref_get_scope(dst, true);
+    uint8_t max_pts = 0, best_match = 0;
+    int last_candidate = -1;
+    ipv6_addr_t *res = NULL;
+
+    memset(points, 0, sizeof(points));
+    for (int i = 0; i < GNRC_IPV6_NETIF_ADDR_NUMOF; i++) {
+        gnrc_ipv6_netif_addr_t *iter = &iface->addrs[i];
+        uint8_t scope;
+
+        if (ipv6_addr_is_multicast(&iter->addr) ||
+            ipv6_addr_is_unspecified(&iter->addr) ||
+            (ll_only && !ipv6_addr_is_link_local(&iter->addr))) {
+            continue;
+        }
+        last_candidate = i;
+        if (ipv6_addr_equal(&iter->addr, dst)) {
+            return &iter->addr;
+        }
+        scope = _ref_get_scope(&iter->addr, false);
+        if (scope == dst_scope) {
+            points[i] += 4;
+        }
+        else if (scope < dst_scope) {
+            points[i] += 2;
+        }
+        if (iter->preferred > 0) {
+            points[i] += 1;
+        }
+        if (points[i] > max_pts) {
+            max_pts = points[i];
+        }
+    }
+    if (last_candidate < 0) {
+        return NULL;
+    }
+    for (int i = 0; i < GNRC_IPV6_NETIF_ADDR_NUMOF; i++) {
+        ipv6_addr_t *addr = &iface->addrs[i].addr;
+        uint8_t match;
+
+        if ((points[i] != max_pts) || gnrc_ipv6_netif_addr_is_non_unicast(addr) ||
+            ipv6_addr_is_unspecified(addr)) {
+            continue;
+        }
+        match = ipv6_addr_match_prefix(addr, dst);
+        if (match > best_match) {
+            res = addr;
+            best_match = match;
+        }
+    }
+    return (res != NULL) ? res : &iface->addrs[last_candidate].addr;
+}
+
+static const char *_src_test_dsts[] = {
+    "fe80::1", "fe80::2", "fe80::1:0:0:1", "fec0::1", "fec0:1::1",
+    "2001:db8::1", "2001:db8::ff:2", "2001:db8:1::1", "2001:db8:8000::1",
+    "3fff::1", "8000::1", "::1",
+};
+
+static void _assert_find_best_src_addr_as_ref(void)
+{
+    ipv6_addr_t dst;
+
+    for (unsigned i = 0; i < (sizeof(_src_test_dsts) / sizeof(_src_test_dsts[0])); i++) {
+        TEST_ASSERT_NOT_NULL(ipv6_addr_from_str(&dst, _src_test_dsts[i]));
+        for (int ll_only = 0; ll_only < 2; ll_only++) {
+            TEST_ASSERT(_ref_find_best_src_addr(DEFAULT_TEST_NETIF, &dst, ll_only) ==
+                        gnrc_ipv6_netif_find_best_src_addr(DEFAULT_TEST_NETIF, &dst,
+                                                           ll_only));
+        }
+    }
+    /* multicast destinations of all scopes */
+    for (uint8_t scope = 0; scope < 16; scope++) {
+        ipv6_addr_set_multicast(&dst, 0, scope);
+        dst.u8[15] = 1;
+        for (int ll_only = 0; ll_only < 2; ll_only++) {
+            TEST_ASSERT(_ref_find_best_src_addr(DEFAULT_TEST_NETIF, &dst, ll_only) ==
+                        gnrc_ipv6_netif_find_best_src_addr(DEFAULT_TEST_NETIF, &dst,
+                                                           ll_only));
+        }
+    }
+}
+
+static const struct {
+    const char *addr;
+    uint8_t flags;
+} _src_test_addrs[] = {
+    { "2001:db8::1", 0 },
+    { "fec0::1", 0 },
+    { "2001:db8:1::", GNRC_IPV6_NETIF_ADDR_FLAGS_NON_UNICAST },
+    { "fe80::1", 0 },
+    { "2001:db8::ff:1", 0 },
+    { "fe80::2", 0 },
+    { "3fff::1", 0 },
+};
+
+#define SRC_TEST_ADDRS_NUMOF    (sizeof(_src_test_addrs) / sizeof(_src_test_addrs[0]))
+
+/* adds as many of _src_test_addrs as fit, compares after every address */
+static void _add_src_test_addrs(ipv6_addr_t **added, unsigned *numof)
+{
+    *numof = 0;
+
+    test_ipv6_netif_add__success(); /* adds DEFAULT_TEST_NETIF as interface */
+    _assert_find_best_src_addr_as_ref();
+    for (unsigned i = 0; i < SRC_TEST_ADDRS_NUMOF; i++) {
+        ipv6_addr_t addr;
+        ipv6_addr_t *res;
+
+        TEST_ASSERT_NOT_NULL(ipv6_addr_from_str(&addr, _src_test_addrs[i].addr));
+        res = gnrc_ipv6_netif_add_addr(DEFAULT_TEST_NETIF, &addr, 64,
+                                       _src_test_addrs[i].flags);
+        if (res == NULL) {
+            break;
+        }
+        added[(*numof)++] = res;
+        _assert_find_best_src_addr_as_ref();
+    }
+    TEST_ASSERT(*numof > 2);
+}
+
+static void test_ipv6_netif_find_best_src_addr__as_ref_add(void)
+{
+    ipv6_addr_t *added[SRC_TEST_ADDRS_NUMOF];
+    unsigned numof;
+
+    _add_src_test_addrs(added, &numof);
+}
+
+static void test_ipv6_netif_find_best_src_addr__as_ref_remove(void)
+{
+    ipv6_addr_t *added[SRC_TEST_ADDRS_NUMOF];
+    unsigned numof;
+
+    _add_src_test_addrs(added, &numof);
+
+    /* remove every second one first, so there are holes */
+    for (unsigned i = 0; i < numof; i += 2) {
+        gnrc_ipv6_netif_remove_addr(DEFAULT_TEST_NETIF, added[i]);
+        _assert_find_best_src_addr_as_ref();
+    }
+    for (unsigned i = 1; i < numof; i += 2) {
+        gnrc_ipv6_netif_remove_addr(DEFAULT_TEST_NETIF, added[i]);
+        _assert_find_best_src_addr_as_ref();
+    }
+}
+
+static void test_ipv6_netif_find_best_src_addr__as_ref_preferred(void)
+{
+    ipv6_addr_t *added[SRC_TEST_ADDRS_NUMOF];
+    unsigned numof;
+
+    _add_src_test_addrs(added, &numof);
+
+    /* all combinations of preferred and deprecated addresses */
+    for (unsigned preferred = 0; preferred < (1U << numof); preferred++) {
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_ipv6_netif_addr_get(added[i])->preferred =
+                (preferred & (1U << i)) ? UINT32_MAX : 0;
+        }
+        gnrc_ipv6_netif_changed();
+        _assert_find_best_src_addr_as_ref();
+    }
+}
+
 static void test_ipv6_netif_addr_is_non_unicast__unicast(void)
 {
     ipv6_addr_t addr = DEFAULT_TEST_IPV6_ADDR;
@@ -565,6 +752,9 @@ Test *tests_ipv6_netif_tests(void)
         new_TestFixture(test_ipv6_netif_find_best_src_addr__success),
         new_TestFixture(test_ipv6_netif_find_best_src_addr__multicast_input),
         new_TestFixture(test_ipv6_netif_find_best_src_addr__other_subnet),
+        new_TestFixture(test_ipv6_netif_find_best_src_addr__as_ref_add),
+        new_TestFixture(test_ipv6_netif_find_best_src_addr__as_ref_remove),
+        new_TestFixture(test_ipv6_netif_find_best_src_addr__as_ref_preferred),
         new_TestFixture(test_ipv6_netif_addr_is_non_unicast__unicast),
         new_TestFixture(test_ipv6_netif_addr_is_non_unicast__anycast),
         new_TestFixture(test_ipv6_netif_addr_is_non_unicast__multicast1),
@@ -26,6 +26,12 @@ static gnrc_netreg_entry_t entries[] = {
     GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16, TEST_UINT8 + 1)
 };
 
+#define SCALE_NUMOF     (384U)
+#define SCALE_DUPS      (4U)
+
+static gnrc_netreg_entry_t scale_entries[SCALE_NUMOF];
+static gnrc_netreg_entry_t scale_all[SCALE_DUPS];
+
 static void set_up(void)
 {
     gnrc_netreg_init();
@@ -139,6 +145,90 @@ void test_netreg_getnext__2_entries(void)
     TEST_ASSERT_NOT_NULL(gnrc_netreg_getnext(res));
 }
 
+void test_netreg_lookup__demux_ctx_all(void)
+{
+    gnrc_netreg_entry_t all = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                         TEST_UINT8);
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &all));
+    TEST_ASSERT(&all == gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                           GNRC_NETREG_DEMUX_CTX_ALL));
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(&all));
+    TEST_ASSERT(&entries[0] == gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(&entries[0]));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                             GNRC_NETREG_DEMUX_CTX_ALL));
+}
+
+void test_netreg_scale(void)
+{
+    gnrc_netreg_entry_t *res;
+    unsigned num;
+
+    /* SCALE_NUMOF / SCALE_DUPS different demux contexts with SCALE_DUPS
+     * registrations each, e.g. a lot of ports */
+    for (unsigned i = 0; i < SCALE_NUMOF; i++) {
+        gnrc_netreg_entry_init_pid(&scale_entries[i],
+                                   TEST_UINT16 + (i / SCALE_DUPS),
+                                   TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                      &scale_entries[i]));
+    }
+    for (unsigned i = 0; i < SCALE_DUPS; i++) {
+        gnrc_netreg_entry_init_pid(&scale_all[i], GNRC_NETREG_DEMUX_CTX_ALL,
+                                   TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                      &scale_all[i]));
+    }
+    for (unsigned ctx = 0; ctx < (SCALE_NUMOF / SCALE_DUPS); ctx++) {
+        TEST_ASSERT_EQUAL_INT(SCALE_DUPS,
+                              gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                              TEST_UINT16 + ctx));
+        /* iteration yields the entries of the context in reverse
+         * registration order */
+        res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + ctx);
+        num = 0;
+        while (res != NULL) {
+            TEST_ASSERT(&scale_entries[(ctx * SCALE_DUPS) + SCALE_DUPS - 1 - num] == res);
+            res = gnrc_netreg_getnext(res);
+            num++;
+        }
+        TEST_ASSERT_EQUAL_INT(SCALE_DUPS, num);
+    }
+    TEST_ASSERT_EQUAL_INT(SCALE_DUPS,
+                          gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                          GNRC_NETREG_DEMUX_CTX_ALL));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                             TEST_UINT16 + (SCALE_NUMOF / SCALE_DUPS)));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_UNDEF, TEST_UINT16));
+
+    /* remove every other entry */
+    for (unsigned i = 0; i < SCALE_NUMOF; i += 2) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &scale_entries[i]);
+    }
+    for (unsigned ctx = 0; ctx < (SCALE_NUMOF / SCALE_DUPS); ctx++) {
+        TEST_ASSERT_EQUAL_INT(SCALE_DUPS / 2,
+                              gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                              TEST_UINT16 + ctx));
+        res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + ctx);
+        while (res != NULL) {
+            TEST_ASSERT(((res - scale_entries) % 2) == 1);
+            TEST_ASSERT_EQUAL_INT(TEST_UINT16 + ctx, res->demux_ctx);
+            res = gnrc_netreg_getnext(res);
+        }
+    }
+    for (unsigned i = 1; i < SCALE_NUMOF; i += 2) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &scale_entries[i]);
+    }
+    for (unsigned ctx = 0; ctx < (SCALE_NUMOF / SCALE_DUPS); ctx++) {
+        TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + ctx));
+    }
+    TEST_ASSERT_EQUAL_INT(SCALE_DUPS,
+                          gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                          GNRC_NETREG_DEMUX_CTX_ALL));
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -155,6 +245,8 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_lookup__demux_ctx_all),
+        new_TestFixture(test_netreg_scale),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -200,6 +200,8 @@ static void test_pktbuf_add__memfull(void)
     TEST_ASSERT(!gnrc_pktbuf_is_empty());
 }
 
+#ifdef MODULE_GNRC_PKTBUF_STATIC
+/* depends on the layout of the first-fit arena of gnrc_pktbuf_static */
 static void test_pktbuf_add__success(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_prev = NULL;
@@ -223,6 +225,50 @@ static void test_pktbuf_add__success(void)
     }
     TEST_ASSERT(gnrc_pktbuf_is_sane());
 }
+#endif
+
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+static void test_pktbuf_add__cached_snips_are_free(void)
+{
+    gnrc_pktsnip_t *pkt1, *pkt2, *pkt3;
+
+    TEST_ASSERT_NOT_NULL((pkt1 = gnrc_pktbuf_add(NULL, NULL, 0, GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_NOT_NULL((pkt2 = gnrc_pktbuf_add(NULL, NULL, 0, GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_NOT_NULL((pkt3 = gnrc_pktbuf_add(NULL, NULL, sizeof(TEST_STRING8),
+                                                 GNRC_NETTYPE_TEST)));
+    gnrc_pktbuf_release(pkt1);
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    gnrc_pktbuf_release(pkt3);
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    gnrc_pktbuf_release(pkt2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    /* checking for emptiness did not return the cached snips */
+    TEST_ASSERT(pkt3 == gnrc_pktbuf_add(NULL, NULL, 0, GNRC_NETTYPE_TEST));
+    gnrc_pktbuf_release(pkt3);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_add__cache_flushed_when_full(void)
+{
+    size_t snip_size = (sizeof(gnrc_pktsnip_t) + sizeof(void *) - 1) &
+                       ~(sizeof(void *) - 1);
+    gnrc_pktsnip_t *pkt1, *pkt2;
+
+    TEST_ASSERT_NOT_NULL((pkt1 = gnrc_pktbuf_add(NULL, NULL, 0, GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_NOT_NULL((pkt2 = gnrc_pktbuf_add(NULL, NULL, 0, GNRC_NETTYPE_TEST)));
+    /* both snips go to the cache, pkt1 is handed out first again */
+    gnrc_pktbuf_release(pkt2);
+    gnrc_pktbuf_release(pkt1);
+    /* only fits if the cached pkt2 is returned to the packet buffer */
+    TEST_ASSERT_NOT_NULL((pkt1 = gnrc_pktbuf_add(NULL, NULL,
+                                                 GNRC_PKTBUF_SIZE - snip_size,
+                                                 GNRC_NETTYPE_TEST)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt1);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
 
 static void test_pktbuf_add__packed_struct(void)
 {
@@ -243,6 +289,8 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
+#ifdef MODULE_GNRC_PKTBUF_STATIC
+/* depends on the layout of the first-fit arena of gnrc_pktbuf_static */
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
@@ -261,6 +309,45 @@ static void test_pktbuf_add__unaligned_in_aligned_hole(void)
     gnrc_pktbuf_release(pkt4);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
+#endif
+
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+static void test_pktbuf_add__slab_reuse(void)
+{
+    gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *pkt2;
+    void *tmp_data1 = pkt1->data;
+
+    gnrc_pktbuf_release(pkt1);
+    /* a block of the same size class is handed out again */
+    pkt2 = gnrc_pktbuf_add(NULL, TEST_STRING12, 9, GNRC_NETTYPE_TEST);
+    TEST_ASSERT(tmp_data1 == pkt2->data);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add__slab_size_class_fallback(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, 1, GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *first = pkt;
+    gnrc_pktsnip_t *big;
+
+    /* exhaust the small size class */
+    for (unsigned i = 1; i < GNRC_PKTBUF_SLAB_SMALL_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(pkt, NULL, 1, GNRC_NETTYPE_TEST)));
+    }
+    /* next one needs to come from a larger size class */
+    TEST_ASSERT_NOT_NULL((big = gnrc_pktbuf_add(NULL, NULL, 1, GNRC_NETTYPE_TEST)));
+    TEST_ASSERT(((uint8_t *)big->data - (uint8_t *)first->data) >=
+                (int)(GNRC_PKTBUF_SLAB_SMALL_SIZE * GNRC_PKTBUF_SLAB_SMALL_NUMOF));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(big);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
 
 static void test_pktbuf_add__0_sized_release(void)
 {
@@ -274,6 +361,53 @@ static void test_pktbuf_add__0_sized_release(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_add_rx__memfull(void)
+{
+    TEST_ASSERT_NULL(gnrc_pktbuf_add_rx(GNRC_PKTBUF_SIZE + 1, 14));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_rx__mark_without_copy(void)
+{
+    gnrc_pktsnip_t *pkt, *l2_hdr, *l3_hdr;
+    uint8_t *data;
+
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add_rx(100, 14)));
+    TEST_ASSERT_NULL(pkt->next);
+    TEST_ASSERT_NOT_NULL(pkt->data);
+    TEST_ASSERT_EQUAL_INT(100, pkt->size);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_UNDEF, pkt->type);
+    TEST_ASSERT_EQUAL_INT(1, pkt->users);
+    data = pkt->data;
+    for (unsigned i = 0; i < pkt->size; i++) {
+        data[i] = (uint8_t)i;
+    }
+    /* received less than expected */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 70));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* headers are views into the received frame */
+    TEST_ASSERT_NOT_NULL((l2_hdr = gnrc_pktbuf_mark(pkt, 14, GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(data == l2_hdr->data);
+    TEST_ASSERT(data + 14 == pkt->data);
+    TEST_ASSERT_NOT_NULL((l3_hdr = gnrc_pktbuf_mark(pkt, 40, GNRC_NETTYPE_TEST)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(data + 14 == l3_hdr->data);
+    TEST_ASSERT(data + 14 + 40 == pkt->data);
+    TEST_ASSERT_EQUAL_INT(70 - 14 - 40, pkt->size);
+    for (unsigned i = 0; i < pkt->size; i++) {
+        TEST_ASSERT_EQUAL_INT(14 + 40 + i, ((uint8_t *)pkt->data)[i]);
+    }
+    /* link layer header is removed first in the stack */
+    pkt = gnrc_pktbuf_remove_snip(pkt, l2_hdr);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(14, ((uint8_t *)l3_hdr->data)[0]);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void test_pktbuf_mark__pkt_NULL__size_0(void)
 {
     TEST_ASSERT_NULL(gnrc_pktbuf_mark(NULL, 0, GNRC_NETTYPE_TEST));
@@ -464,6 +598,27 @@ static void test_pktbuf_mark__success_small(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_mark__remainder_aligned(void)
+{
+    gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, TEST_STRING64, sizeof(TEST_STRING64),
+                                           GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *pkt2;
+
+    TEST_ASSERT_NOT_NULL(pkt1);
+    /* e.g. the 6LoWPAN dispatch in front of an uncompressed IPv6 header */
+    TEST_ASSERT_NOT_NULL((pkt2 = gnrc_pktbuf_mark(pkt1, 1, GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(0, ((uintptr_t)pkt1->data) % sizeof(void *));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING64) - 1, pkt1->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 1, pkt1->data, pkt1->size));
+    TEST_ASSERT_EQUAL_INT(1, pkt2->size);
+    TEST_ASSERT_EQUAL_INT(TEST_STRING64[0], ((uint8_t *)pkt2->data)[0]);
+
+    gnrc_pktbuf_release(pkt1);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void test_pktbuf_mark__success_equally_sized(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
@@ -824,10 +979,24 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_add__pkt_NOT_NULL__data_NULL__size_not_0),
         new_TestFixture(test_pktbuf_add__pkt_NOT_NULL__data_NOT_NULL__size_not_0),
         new_TestFixture(test_pktbuf_add__memfull),
+#ifdef MODULE_GNRC_PKTBUF_STATIC
         new_TestFixture(test_pktbuf_add__success),
+#endif
+#ifdef MODULE_GNRC_PKTBUF_STATIC_CACHE
+        new_TestFixture(test_pktbuf_add__cached_snips_are_free),
+        new_TestFixture(test_pktbuf_add__cache_flushed_when_full),
+#endif
         new_TestFixture(test_pktbuf_add__packed_struct),
+#ifdef MODULE_GNRC_PKTBUF_STATIC
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
+#endif
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+        new_TestFixture(test_pktbuf_add__slab_reuse),
+        new_TestFixture(test_pktbuf_add__slab_size_class_fallback),
+#endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
+        new_TestFixture(test_pktbuf_add_rx__memfull),
+        new_TestFixture(test_pktbuf_add_rx__mark_without_copy),
         new_TestFixture(test_pktbuf_mark__pkt_NULL__size_0),
         new_TestFixture(test_pktbuf_mark__pkt_NULL__size_not_0),
         new_TestFixture(test_pktbuf_mark__pkt_NOT_NULL__size_0),
@@ -836,6 +1005,7 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_mark__success_large),
         new_TestFixture(test_pktbuf_mark__success_aligned),
         new_TestFixture(test_pktbuf_mark__success_small),
+        new_TestFixture(test_pktbuf_mark__remainder_aligned),
         new_TestFixture(test_pktbuf_mark__success_equally_sized),
         new_TestFixture(test_pktbuf_realloc_data__size_0),
         new_TestFixture(test_pktbuf_realloc_data__memfull),
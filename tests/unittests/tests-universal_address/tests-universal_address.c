@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "universal_address.h"
+#include "tests-universal_address.h"
+
+#define ENTRIES     (UNIVERSAL_ADDRESS_MAX_ENTRIES)
+
+static universal_address_container_t *_entries[ENTRIES];
+
+static void set_up(void)
+{
+    universal_address_reset();
+    memset(_entries, 0, sizeof(_entries));
+}
+
+/* builds an address of size bytes that is unique for i */
+static void _build_addr(uint8_t *addr, size_t size, unsigned i)
+{
+    for (size_t j = 0; j < size; j++) {
+        addr[j] = (uint8_t)(i + j);
+    }
+    addr[0] = (uint8_t)i;
+    addr[size - 1] ^= (uint8_t)(size << 4);
+}
+
+static universal_address_container_t *_add(size_t size, unsigned i)
+{
+    uint8_t addr[UNIVERSAL_ADDRESS_SIZE];
+
+    _build_addr(addr, size, i);
+    return universal_address_add(addr, size);
+}
+
+static int _check(universal_address_container_t *entry, size_t size,
+                  unsigned i)
+{
+    uint8_t expected[UNIVERSAL_ADDRESS_SIZE];
+    uint8_t addr[UNIVERSAL_ADDRESS_SIZE];
+    size_t addr_size = sizeof(addr);
+
+    _build_addr(expected, size, i);
+    return (universal_address_get_address(entry, addr, &addr_size) != NULL) &&
+           (addr_size == size) && (memcmp(addr, expected, size) == 0);
+}
+
+static void _remove_all(void)
+{
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        if (_entries[i] != NULL) {
+            universal_address_rem(_entries[i]);
+            _entries[i] = NULL;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(0, universal_address_get_num_used_entries());
+}
+
+static void test_universal_address_add__same_twice(void)
+{
+    universal_address_container_t *entry = _add(8, 1);
+
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT(entry == _add(8, 1));
+    TEST_ASSERT(entry != _add(4, 1));
+    TEST_ASSERT_EQUAL_INT(2, universal_address_get_num_used_entries());
+    TEST_ASSERT(_check(entry, 8, 1));
+}
+
+static void test_universal_address_add__full(void)
+{
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        _entries[i] = _add(UNIVERSAL_ADDRESS_SIZE, i);
+        TEST_ASSERT_NOT_NULL(_entries[i]);
+    }
+    TEST_ASSERT_NULL(_add(UNIVERSAL_ADDRESS_SIZE, ENTRIES));
+    TEST_ASSERT_NULL(_add(1, ENTRIES));
+    TEST_ASSERT_EQUAL_INT(ENTRIES, universal_address_get_num_used_entries());
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        TEST_ASSERT(_check(_entries[i], UNIVERSAL_ADDRESS_SIZE, i));
+    }
+}
+
+static void test_universal_address_add__longer_after_remove_all(void)
+{
+    /* use up all containers with short addresses */
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        _entries[i] = _add(2, i);
+        TEST_ASSERT_NOT_NULL(_entries[i]);
+    }
+    TEST_ASSERT_NULL(_add(2, ENTRIES));
+    _remove_all();
+
+    /* the table is empty, so all containers take the widest addresses */
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        _entries[i] = _add(UNIVERSAL_ADDRESS_SIZE, i);
+        TEST_ASSERT_NOT_NULL(_entries[i]);
+    }
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        TEST_ASSERT(_check(_entries[i], UNIVERSAL_ADDRESS_SIZE, i));
+    }
+    _remove_all();
+
+    /* and short ones again */
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        _entries[i] = _add(2, i);
+        TEST_ASSERT_NOT_NULL(_entries[i]);
+    }
+}
+
+static void test_universal_address_add__mixed_sizes(void)
+{
+    /* sizes 1 to UNIVERSAL_ADDRESS_SIZE in turn */
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        _entries[i] = _add((i % UNIVERSAL_ADDRESS_SIZE) + 1, i);
+        TEST_ASSERT_NOT_NULL(_entries[i]);
+    }
+
+    /* replace every other one by a widest address */
+    for (unsigned i = 0; i < ENTRIES; i += 2) {
+        universal_address_rem(_entries[i]);
+        _entries[i] = NULL;
+    }
+    for (unsigned i = 0; i < ENTRIES; i += 2) {
+        _entries[i] = _add(UNIVERSAL_ADDRESS_SIZE, i);
+        TEST_ASSERT_NOT_NULL(_entries[i]);
+    }
+
+    /* all addresses are still intact and can be found */
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        size_t size = (i & 1) ? (i % UNIVERSAL_ADDRESS_SIZE) + 1 :
+                                UNIVERSAL_ADDRESS_SIZE;
+
+        TEST_ASSERT(_check(_entries[i], size, i));
+        TEST_ASSERT(_entries[i] == _add(size, i));
+        universal_address_rem(_entries[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(ENTRIES, universal_address_get_num_used_entries());
+    _remove_all();
+}
+
+static void test_universal_address_add__address_stays(void)
+{
+    uint8_t *addr[ENTRIES];
+
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        _entries[i] = _add((i % UNIVERSAL_ADDRESS_SIZE) + 1, i);
+        TEST_ASSERT_NOT_NULL(_entries[i]);
+        addr[i] = _entries[i]->address;
+    }
+
+    /* the address data of the remaining containers must not move while
+     * other containers are removed and reused */
+    for (unsigned i = 0; i < ENTRIES; i += 2) {
+        universal_address_rem(_entries[i]);
+        _entries[i] = NULL;
+    }
+    for (unsigned i = 0; i < ENTRIES; i += 2) {
+        _entries[i] = _add(UNIVERSAL_ADDRESS_SIZE, i);
+        TEST_ASSERT_NOT_NULL(_entries[i]);
+    }
+    for (unsigned i = 1; i < ENTRIES; i += 2) {
+        TEST_ASSERT(_entries[i]->address == addr[i]);
+        TEST_ASSERT(_check(_entries[i], (i % UNIVERSAL_ADDRESS_SIZE) + 1, i));
+    }
+    _remove_all();
+}
+
+Test *tests_universal_address_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_universal_address_add__same_twice),
+        new_TestFixture(test_universal_address_add__full),
+        new_TestFixture(test_universal_address_add__longer_after_remove_all),
+        new_TestFixture(test_universal_address_add__mixed_sizes),
+        new_TestFixture(test_universal_address_add__address_stays),
+    };
+
+    EMB_UNIT_TESTCALLER(universal_address_tests, set_up, NULL, fixtures);
+
+    return (Test *)&universal_address_tests;
+}
+
+void tests_universal_address(void)
+{
+    TESTS_RUN(tests_universal_address_tests());
+}
+/** @} */
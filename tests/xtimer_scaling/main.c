@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures how xtimer scales with the number of active timers
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "xtimer.h"
+
+#define MAX_TIMERS      (1000U)
+#define OFFSET_MIN      (1U * US_PER_SEC)
+#define OFFSET_SPREAD   (1U * US_PER_SEC)
+#define FIRE_OFFSET     (200U * US_PER_MS)
+
+static const unsigned _numof[] = { 10, 100, MAX_TIMERS };
+
+static xtimer_t _timers[MAX_TIMERS];
+
+static volatile unsigned _fired;
+static volatile uint32_t _first_fired;
+static volatile uint32_t _last_fired;
+
+static void _cb(void *arg)
+{
+    (void)arg;
+    uint32_t now = xtimer_now_usec();
+
+    if (_fired++ == 0) {
+        _first_fired = now;
+    }
+    _last_fired = now;
+}
+
+/* cheap pseudo random offsets, so timers end up in arbitrary positions */
+static uint32_t _offset(unsigned i)
+{
+    return OFFSET_MIN + ((i * 2654435761U) % OFFSET_SPREAD);
+}
+
+static uint32_t _ns_per_op(uint32_t us, unsigned numof)
+{
+    return (uint32_t)(((uint64_t)us * 1000) / numof);
+}
+
+static uint32_t _insert(unsigned numof)
+{
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < numof; i++) {
+        xtimer_set(&_timers[i], _offset(i));
+    }
+    return xtimer_now_usec() - start;
+}
+
+static uint32_t _remove(unsigned numof)
+{
+    uint32_t start = xtimer_now_usec();
+
+    /* remove in a different order than inserted */
+    for (unsigned i = 0; i < numof; i++) {
+        xtimer_remove(&_timers[(i * 7U) % numof]);
+    }
+    return xtimer_now_usec() - start;
+}
+
+static uint32_t _fire(unsigned numof)
+{
+    uint32_t target = xtimer_now_usec() + FIRE_OFFSET;
+
+    _fired = 0;
+    for (unsigned i = 0; i < numof; i++) {
+        xtimer_set(&_timers[i], target - xtimer_now_usec());
+    }
+    while (_fired < numof) {
+        xtimer_usleep(FIRE_OFFSET);
+    }
+    return _last_fired - _first_fired;
+}
+
+int main(void)
+{
+#ifdef MODULE_XTIMER_WHEEL
+    puts("xtimer scaling (wheel)");
+#else
+    puts("xtimer scaling (list)");
+#endif
+
+    for (unsigned i = 0; i < MAX_TIMERS; i++) {
+        _timers[i].callback = _cb;
+        _timers[i].arg = NULL;
+    }
+
+    for (unsigned i = 0; i < (sizeof(_numof) / sizeof(_numof[0])); i++) {
+        unsigned numof = _numof[i];
+        uint32_t insert = _insert(numof);
+        uint32_t remove = _remove(numof);
+        uint32_t fire = _fire(numof);
+
+        printf("+ %4u timers: insert %" PRIu32 " ns, remove %" PRIu32
+               " ns, fire %" PRIu32 " ns\n", numof, _ns_per_op(insert, numof),
+               _ns_per_op(remove, numof), _ns_per_op(fire, numof - 1));
+    }
+    puts("done");
+
+    return 0;
+}